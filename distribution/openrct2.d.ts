@@ -251,21 +251,48 @@ declare global {
         executeAction(action: ActionType, args: object, callback: (result: GameActionResult) => void): void;
         executeAction(action: string, args: object, callback: (result: GameActionResult) => void): void;
 
+        /**
+         * Query the combined result of running several game actions. The query fails if any of the actions fail.
+         * Every action is queried against the current state of the park, so actions that depend on each other,
+         * e.g. placing scenery on the same tile, can all pass the query and still fail when executed.
+         * @param actions The actions to query.
+         * @param callback The function to be called with the combined result of the actions.
+         */
+        queryActions(actions: GameActionDesc[], callback: (result: GameActionResult) => void): void;
+
+        /**
+         * Executes several game actions together within the same tick. In a network game, they are sent to the
+         * server as a single request. Nothing is executed if any of the actions fail the query. If an action fails
+         * when executed, e.g. because an earlier action in the list changed the park, the remaining actions are
+         * skipped and the callback receives the error of the failed action. Actions executed before it are kept.
+         * @param actions The actions to execute.
+         * @param callback The function to be called with the combined result of the actions.
+         */
+        executeActions(actions: GameActionDesc[], callback: (result: GameActionResult) => void): void;
+
         /**
          * Subscribes to the given hook.
+         * @param hook The hook to subscribe to.
+         * @param callback The function to call when the hook is triggered.
+         * @param filter If given, the callback is only called for events that match all of the filter's criteria.
+         * Unmatched events are skipped before any event arguments are created.
          */
-        subscribe(hook: HookType, callback: Function): IDisposable;
+        subscribe(hook: HookType, callback: Function, filter?: HookFilter): IDisposable;
 
-        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
-        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void, filter?: HookFilter): IDisposable;
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void, filter?: HookFilter): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "network.chat", callback: (e: NetworkChatEventArgs) => void): IDisposable;
         subscribe(hook: "network.authenticate", callback: (e: NetworkAuthenticateEventArgs) => void): IDisposable;
         subscribe(hook: "network.join", callback: (e: NetworkEventArgs) => void): IDisposable;
         subscribe(hook: "network.leave", callback: (e: NetworkEventArgs) => void): IDisposable;
-        subscribe(hook: "ride.ratings.calculate", callback: (e: RideRatingsCalculateArgs) => void): IDisposable;
-        subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void): IDisposable;
+        subscribe(
+            hook: "ride.ratings.calculate",
+            callback: (e: RideRatingsCalculateArgs) => void,
+            filter?: HookFilter
+        ): IDisposable;
+        subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void, filter?: HookFilter): IDisposable;
         subscribe(hook: "guest.generation", callback: (id: number) => void): IDisposable;
 
         /**
@@ -367,6 +394,35 @@ declare global {
         "network.chat" | "network.action" | "network.join" | "network.leave" |
         "ride.ratings.calculate" | "action.location";
 
+    /**
+     * Limits which events a hook subscription is called for. An event that does not carry the information a
+     * criterion needs does not match it, e.g. actions without a location never match a range.
+     */
+    interface HookFilter {
+        /**
+         * Only call for these actions, names that are not built-in actions refer to custom actions.
+         * Supported by action.query, action.execute and action.location.
+         */
+        actions?: string[];
+
+        /**
+         * Only call for actions performed by this player.
+         * Supported by action.query, action.execute and action.location.
+         */
+        player?: number;
+
+        /**
+         * Only call for actions located within this range.
+         * Supported by action.query, action.execute and action.location.
+         */
+        range?: MapRange;
+
+        /**
+         * Only call for this ride. Supported by ride.ratings.calculate.
+         */
+        rideId?: number;
+    }
+
     type ExpenditureType =
         "ride_construction" |
         "ride_runningcosts" |
@@ -451,6 +507,7 @@ declare global {
         "staffsetpatrolarea" |
         "surfacesetstyle" |
         "tilemodify" |
+        "tileregionset" |
         "trackdesign" |
         "trackplace" |
         "trackremove" |
@@ -462,6 +519,11 @@ declare global {
         "waterraise" |
         "watersetheight";
 
+    interface GameActionDesc {
+        action: ActionType | string;
+        args: object;
+    }
+
     interface GameActionEventArgs {
         readonly player: number;
         readonly type: number;
@@ -563,6 +625,78 @@ declare global {
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         getAllEntities(type: "peep"): Peep[];
+
+        /**
+         * Reads fields of every entity of the given type into typed arrays, without creating an object per entity.
+         * Index i of each array refers to the same entity. Fields that an entity does not have are read as 0.
+         * The state field holds the internal peep state number.
+         * @param type The type of entity to query. Supported types are balloon, car, duck, litter and peep.
+         * @param fields The fields to read.
+         * @param range If given, only entities on tiles within this range are included.
+         */
+        queryEntities(type: EntityType, fields: EntityDataField[], range?: MapRange): EntityData;
+
+        /**
+         * Reads the elements of every tile within the given range into a single buffer.
+         * @param range The tiles to read, both corners are included.
+         */
+        getTileData(range: MapRange): TileData;
+
+        /**
+         * Replaces the elements of every tile within the given range. The data is validated and applied using
+         * the tileregionset game action, so it is synchronised in multiplayer. Every tile must contain exactly
+         * one surface element. Large regions are split into several actions, all of them are validated before
+         * any tile is changed.
+         * @param range The tiles to write, this must cover the same tiles as the range the data was read from.
+         * @param data The tile data, usually from getTileData.
+         */
+        setTileData(range: MapRange, data: TileData): void;
+    }
+
+    /**
+     * The raw elements of a range of tiles. Tiles are ordered row by row from the top left corner of the range.
+     */
+    interface TileData {
+        /**
+         * The number of elements on each tile.
+         */
+        counts: Uint16Array;
+
+        /**
+         * The raw elements of all the tiles, one after the other. Each element takes up 16 bytes, the same layout
+         * as Tile.data.
+         */
+        data: Uint8Array;
+    }
+
+    type EntityDataField =
+        "id" |
+        "x" |
+        "y" |
+        "z" |
+        "state" |
+        "energy" |
+        "happiness" |
+        "nausea" |
+        "hunger" |
+        "thirst" |
+        "toilet" |
+        "cash";
+
+    interface EntityData {
+        readonly count: number;
+        readonly id?: Uint16Array;
+        readonly x?: Int32Array;
+        readonly y?: Int32Array;
+        readonly z?: Int32Array;
+        readonly state?: Uint8Array;
+        readonly energy?: Uint8Array;
+        readonly happiness?: Uint8Array;
+        readonly nausea?: Uint8Array;
+        readonly hunger?: Uint8Array;
+        readonly thirst?: Uint8Array;
+        readonly toilet?: Uint8Array;
+        readonly cash?: Int32Array;
     }
 
     type TileElementType =
@@ -10,10 +10,14 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <openrct2/Game.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/core/JobPool.h>
+#include <openrct2/drawing/Drawing.h>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/drawing/LightFX.h>
 #include <openrct2/drawing/X8DrawingEngine.h>
@@ -50,6 +54,17 @@ private:
 
     std::vector<uint32_t> _dirtyVisualsTime;
 
+    // Copy of the bits last converted into the screen texture, so only changed blocks need converting again
+    std::vector<uint8_t> _textureBits;
+    std::vector<uint8_t> _textureDirtyBlocks;
+    bool _textureInvalidated = true;
+
+    // Frame whose conversion into the locked screen texture is still running on _presentJobs
+    std::unique_ptr<JobPool> _presentJobs;
+    std::vector<SDL_Rect> _pendingRegions;
+    uint32_t _pendingPalette[256] = { 0 };
+    bool _presentPending = false;
+
     bool smoothNN = false;
 
 public:
@@ -62,6 +77,7 @@ public:
 
     ~HardwareDisplayDrawingEngine() override
     {
+        FinishPendingPresent();
         SDL_FreeFormat(_screenTextureFormat);
         SDL_DestroyRenderer(_sdlRenderer);
     }
@@ -75,6 +91,7 @@ public:
     {
         if (_useVsync != vsync)
         {
+            FinishPendingPresent();
             _useVsync = vsync;
             SDL_DestroyRenderer(_sdlRenderer);
             _screenTexture = nullptr;
@@ -91,6 +108,7 @@ public:
             return;
         }
 
+        FinishPendingPresent();
         if (_screenTexture != nullptr)
         {
             SDL_DestroyTexture(_screenTexture);
@@ -153,6 +171,7 @@ public:
         _screenTextureFormat = SDL_AllocFormat(format);
 
         ConfigureBits(width, height, width);
+        _textureInvalidated = true;
     }
 
     void SetPalette(const GamePalette& palette) override
@@ -161,7 +180,12 @@ public:
         {
             for (int32_t i = 0; i < 256; i++)
             {
-                _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
+                auto colour = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
+                if (_paletteHWMapped[i] != colour)
+                {
+                    _paletteHWMapped[i] = colour;
+                    _textureInvalidated = true;
+                }
             }
 
 #ifdef __ENABLE_LIGHTFX__
@@ -178,8 +202,15 @@ public:
         }
     }
 
+    void BeginDraw() override
+    {
+        FinishPendingPresent();
+        X8DrawingEngine::BeginDraw();
+    }
+
     void EndDraw() override
     {
+        FinishPendingPresent();
         Display();
         if (gShowDirtyVisuals)
         {
@@ -187,9 +218,71 @@ public:
         }
     }
 
+    void EndDrawPipelined() override
+    {
+        FinishPendingPresent();
+        if (!CanPipelinePresent())
+        {
+            EndDraw();
+            return;
+        }
+
+        if (_presentJobs == nullptr)
+        {
+            _presentJobs = std::make_unique<JobPool>(1);
+        }
+
+        // The changed regions are copied into _textureBits here, which the next frame does not draw into, so only
+        // the palette conversion has to run on the worker. SDL only allows one locked rect and leaves its contents
+        // undefined, so the whole bounding rect is converted. _textureBits mirrors the texture outside the changed
+        // regions, so this rewrites the gaps between them with what they already showed.
+        CollectChangedRegions();
+        if (!_pendingRegions.empty())
+        {
+            SDL_Rect bounds = _pendingRegions[0];
+            for (const auto& region : _pendingRegions)
+            {
+                SDL_UnionRect(&bounds, &region, &bounds);
+            }
+
+            void* pixels;
+            int32_t pitch;
+            if (SDL_LockTexture(_screenTexture, &bounds, &pixels, &pitch) == 0)
+            {
+                std::copy(std::begin(_paletteHWMapped), std::end(_paletteHWMapped), std::begin(_pendingPalette));
+                _presentJobs->AddTask([this, bounds, pixels, pitch]() -> void {
+                    for (int32_t yy = 0; yy < bounds.h; yy++)
+                    {
+                        size_t offset = (bounds.y + yy) * _pitch + bounds.x;
+                        uint32_t* dst = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(pixels) + yy * pitch);
+                        palette_expand_fn(_textureBits.data() + offset, dst, bounds.w, _pendingPalette);
+                    }
+                });
+            }
+            else
+            {
+                _pendingRegions.clear();
+            }
+        }
+
+        _presentPending = true;
+        if (gShowDirtyVisuals)
+        {
+            UpdateDirtyVisuals();
+        }
+    }
+
 protected:
     void OnDrawDirtyBlock(uint32_t left, uint32_t top, uint32_t columns, uint32_t rows) override
     {
+        if (_textureDirtyBlocks.size() == _dirtyGrid.BlockColumns * _dirtyGrid.BlockRows)
+        {
+            for (uint32_t y = top; y < top + rows; y++)
+            {
+                std::fill_n(_textureDirtyBlocks.begin() + (y * _dirtyGrid.BlockColumns + left), columns, 1);
+            }
+        }
+
         if (gShowDirtyVisuals)
         {
             uint32_t right = left + columns;
@@ -205,6 +298,34 @@ protected:
     }
 
 private:
+    bool CanPipelinePresent() const
+    {
+#ifdef __ENABLE_LIGHTFX__
+        if (gConfigGeneral.enable_light_fx)
+        {
+            return false;
+        }
+#endif
+        return _screenTextureFormat != nullptr && SDL_BYTESPERPIXEL(_screenTextureFormat->format) == 4;
+    }
+
+    void FinishPendingPresent()
+    {
+        if (!_presentPending)
+        {
+            return;
+        }
+
+        _presentPending = false;
+        if (!_pendingRegions.empty())
+        {
+            _presentJobs->Join();
+            SDL_UnlockTexture(_screenTexture);
+            _pendingRegions.clear();
+        }
+        Present();
+    }
+
     void Display()
     {
 #ifdef __ENABLE_LIGHTFX__
@@ -217,13 +338,26 @@ private:
                 lightfx_render_to_texture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+
+            // The light map changes every frame, so the whole texture has been rewritten
+            _textureInvalidated = true;
         }
         else
 #endif
+        if (SDL_BYTESPERPIXEL(_screenTextureFormat->format) == 4)
+        {
+            CopyChangedBitsToTexture();
+        }
+        else
         {
             CopyBitsToTexture(
                 _screenTexture, _bits, static_cast<int32_t>(_width), static_cast<int32_t>(_height), _paletteHWMapped);
         }
+        Present();
+    }
+
+    void Present()
+    {
         if (smoothNN)
         {
             SDL_SetRenderTarget(_sdlRenderer, _scaledScreenTexture);
@@ -304,6 +438,123 @@ private:
         }
     }
 
+    /**
+     * Converts only the blocks of the screen that differ from what is already in the texture. Blocks drawn this frame
+     * are known to have changed, the rest are compared against the last converted bits as weather, the cursor and
+     * overlays are drawn straight into the bits and viewport scrolling moves them without drawing.
+     */
+    void CopyChangedBitsToTexture()
+    {
+        CollectChangedRegions();
+        for (const auto& region : _pendingRegions)
+        {
+            CopyRegionToTexture(region.x, region.y, region.w, region.h);
+        }
+        _pendingRegions.clear();
+    }
+
+    /**
+     * Fills _pendingRegions with the horizontal runs of changed blocks and copies them into _textureBits.
+     */
+    void CollectChangedRegions()
+    {
+        _pendingRegions.clear();
+
+        const size_t blockCount = _dirtyGrid.BlockColumns * _dirtyGrid.BlockRows;
+        if (_textureInvalidated || _textureBits.size() != _bitsSize || _textureDirtyBlocks.size() != blockCount)
+        {
+            _textureBits.resize(_bitsSize);
+            _textureDirtyBlocks.assign(blockCount, 0);
+            AddChangedRegion(0, 0, _width, _height);
+            _textureInvalidated = false;
+            return;
+        }
+
+        for (uint32_t y = 0; y < _dirtyGrid.BlockRows; y++)
+        {
+            uint32_t top = y * _dirtyGrid.BlockHeight;
+            uint32_t bottom = std::min(_height, top + _dirtyGrid.BlockHeight);
+            if (top >= bottom)
+            {
+                continue;
+            }
+
+            // Convert each horizontal run of changed blocks in one go
+            uint32_t x = 0;
+            while (x < _dirtyGrid.BlockColumns)
+            {
+                if (!HasTextureBlockChanged(x, y))
+                {
+                    x++;
+                    continue;
+                }
+
+                uint32_t left = x * _dirtyGrid.BlockWidth;
+                do
+                {
+                    x++;
+                } while (x < _dirtyGrid.BlockColumns && HasTextureBlockChanged(x, y));
+                uint32_t right = std::min(_width, x * _dirtyGrid.BlockWidth);
+                if (left < right)
+                {
+                    AddChangedRegion(left, top, right - left, bottom - top);
+                }
+            }
+        }
+        std::fill(_textureDirtyBlocks.begin(), _textureDirtyBlocks.end(), 0);
+    }
+
+    bool HasTextureBlockChanged(uint32_t x, uint32_t y)
+    {
+        if (_textureDirtyBlocks[y * _dirtyGrid.BlockColumns + x] != 0)
+        {
+            return true;
+        }
+
+        uint32_t left = x * _dirtyGrid.BlockWidth;
+        uint32_t top = y * _dirtyGrid.BlockHeight;
+        uint32_t right = std::min(_width, left + _dirtyGrid.BlockWidth);
+        uint32_t bottom = std::min(_height, top + _dirtyGrid.BlockHeight);
+        for (uint32_t yy = top; yy < bottom; yy++)
+        {
+            size_t offset = yy * _pitch + left;
+            if (std::memcmp(_bits + offset, _textureBits.data() + offset, right - left) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void AddChangedRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        for (uint32_t yy = y; yy < y + height; yy++)
+        {
+            size_t offset = yy * _pitch + x;
+            std::copy_n(_bits + offset, width, _textureBits.data() + offset);
+        }
+        _pendingRegions.push_back(
+            { static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(width), static_cast<int32_t>(height) });
+    }
+
+    void CopyRegionToTexture(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        SDL_Rect rect = { static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(width),
+                          static_cast<int32_t>(height) };
+        void* pixels;
+        int32_t pitch;
+        if (SDL_LockTexture(_screenTexture, &rect, &pixels, &pitch) == 0)
+        {
+            for (uint32_t yy = 0; yy < height; yy++)
+            {
+                size_t offset = (y + yy) * _pitch + x;
+                uint32_t* dst = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(pixels) + yy * pitch);
+                palette_expand_fn(_textureBits.data() + offset, dst, width, _paletteHWMapped);
+            }
+            SDL_UnlockTexture(_screenTexture);
+        }
+    }
+
     uint32_t GetDirtyVisualTime(uint32_t x, uint32_t y)
     {
         uint32_t result = 0;
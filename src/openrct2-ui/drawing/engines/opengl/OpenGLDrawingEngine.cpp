@@ -299,6 +299,11 @@ public:
         _drawingContext->StartNewDraw();
     }
 
+    void EndDrawPipelined() override
+    {
+        EndDraw();
+    }
+
     void EndDraw() override
     {
         _drawingContext->FlushCommandBuffers();
@@ -26,6 +26,7 @@
 #include <openrct2/Input.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
+#include <openrct2/actions/BatchAction.h>
 #include <openrct2/actions/BannerPlaceAction.h>
 #include <openrct2/actions/BannerSetColourAction.h>
 #include <openrct2/actions/ClearAction.h>
@@ -50,6 +51,7 @@
 #include <openrct2/interface/Chat.h>
 #include <openrct2/interface/InteractiveConsole.h>
 #include <openrct2/interface/Screenshot.h>
+#include <openrct2/management/Finance.h>
 #include <openrct2/network/network.h>
 #include <openrct2/paint/VirtualFloor.h>
 #include <openrct2/peep/Staff.h>
@@ -1747,6 +1749,20 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
             }
 
             bool forceError = true;
+            BatchAction clusterAction;
+            // Every item of a cluster is queried before any of them is placed, items that share a spot would fail
+            std::vector<std::pair<CoordsXY, uint8_t>> clusterSpots;
+            money32 clusterCost = 0;
+            auto executeCluster = [&clusterAction]() {
+                clusterAction.SetCallback([](const GameAction* ga, const GameActions::Result* result) {
+                    if (result->Error == GameActions::Status::Ok)
+                    {
+                        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
+                    }
+                });
+                GameActions::Execute(&clusterAction);
+                clusterAction.Clear();
+            };
             for (int32_t q = 0; q < quantity; q++)
             {
                 int32_t zCoordinate = gSceneryPlaceZ;
@@ -1785,6 +1801,7 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                 }
 
                 auto success = GameActions::Status::Unknown;
+                money32 cost = 0;
                 // Try find a valid z coordinate
                 for (; zAttemptRange != 0; zAttemptRange--)
                 {
@@ -1795,6 +1812,7 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                     success = res->Error;
                     if (res->Error == GameActions::Status::Ok)
                     {
+                        cost = res->Cost;
                         break;
                     }
 
@@ -1808,8 +1826,39 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                     }
                 }
 
+                // A cluster is placed with a single action once all its items have been found a spot
+                if (isCluster && success == GameActions::Status::Ok)
+                {
+                    std::pair<CoordsXY, uint8_t> spot{
+                        { cur_grid_x, cur_grid_y },
+                        scenery_small_entry_has_flag(sceneryEntry, SMALL_SCENERY_FLAG_FULL_TILE) ? 0 : quadrant };
+                    if (std::find(clusterSpots.begin(), clusterSpots.end(), spot) == clusterSpots.end())
+                    {
+                        // Place as many items as can be afforded, like placing them one by one would
+                        if (!finance_check_affordability(clusterCost + cost, 0))
+                        {
+                            gSceneryPlaceZ = zCoordinate;
+                            break;
+                        }
+                        clusterCost += cost;
+                        clusterSpots.push_back(spot);
+                        auto makeAction = [&]() {
+                            return std::make_unique<SmallSceneryPlaceAction>(
+                                CoordsXYZD{ cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant,
+                                selectedScenery, gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour);
+                        };
+                        if (!clusterAction.Add(makeAction()))
+                        {
+                            // The batch is full, place what has been gathered so far and start a new one
+                            executeCluster();
+                            clusterAction.Add(makeAction());
+                        }
+                    }
+                }
                 // Actually place
-                if (success == GameActions::Status::Ok || ((q + 1 == quantity) && forceError))
+                else if (
+                    success == GameActions::Status::Ok
+                    || ((q + 1 == quantity) && forceError && clusterAction.IsEmpty()))
                 {
                     auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
                         { cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
@@ -1834,6 +1883,11 @@ static void window_top_toolbar_scenery_tool_down(const ScreenCoordsXY& windowPos
                 }
                 gSceneryPlaceZ = zCoordinate;
             }
+
+            if (!clusterAction.IsEmpty())
+            {
+                executeCluster();
+            }
             break;
         }
         case SCENERY_TYPE_PATH_ITEM:
@@ -13,6 +13,7 @@
 #include "OpenRCT2.h"
 #include "core/FileStream.h"
 #include "core/Imaging.h"
+#include "core/JobPool.h"
 #include "core/Json.hpp"
 #include "drawing/Drawing.h"
 #include "drawing/ImageImporter.h"
@@ -25,6 +26,8 @@
 #include <cmath>
 #include <cstring>
 #include <optional>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #    include "core/String.hpp"
@@ -597,7 +600,16 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
 
         fprintf(stdout, "Building: %s\n", spriteFilePath);
 
-        json_t sprite_description;
+        struct SpriteBuildItem
+        {
+            std::string ImagePath;
+            int16_t XOffset{};
+            int16_t YOffset{};
+            bool KeepPalette{};
+            bool ForceBmp{};
+            std::optional<ImageImporter::ImportResult> ImportResult;
+        };
+        std::vector<SpriteBuildItem> items;
 
         // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const
         for (auto& [jsonKey, jsonSprite] : jsonSprites.items())
@@ -619,24 +631,40 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
             json_t x_offset = jsonSprite["x_offset"];
             json_t y_offset = jsonSprite["y_offset"];
 
-            bool keep_palette = Json::GetString(jsonSprite["palette"]) == "keep";
-            bool forceBmp = !jsonSprite["palette"].is_null() && Json::GetBoolean(jsonSprite["forceBmp"]);
+            auto& item = items.emplace_back();
+            item.ImagePath = platform_get_absolute_path(strPath.c_str(), directoryPath);
+            item.XOffset = Json::GetNumber<int16_t>(x_offset);
+            item.YOffset = Json::GetNumber<int16_t>(y_offset);
+            item.KeepPalette = Json::GetString(jsonSprite["palette"]) == "keep";
+            item.ForceBmp = !jsonSprite["palette"].is_null() && Json::GetBoolean(jsonSprite["forceBmp"]);
+        }
 
-            auto imagePath = platform_get_absolute_path(strPath.c_str(), directoryPath);
+        // Every image is imported on its own, only adding them to the sprite file has to be done in order
+        {
+            JobPool jobPool;
+            for (auto& item : items)
+            {
+                jobPool.AddTask([&item]() {
+                    item.ImportResult = SpriteImageImport(
+                        item.ImagePath.c_str(), item.XOffset, item.YOffset, item.KeepPalette, item.ForceBmp,
+                        gSpriteMode);
+                });
+            }
+            jobPool.Join();
+        }
 
-            auto importResult = SpriteImageImport(
-                imagePath.c_str(), Json::GetNumber<int16_t>(x_offset), Json::GetNumber<int16_t>(y_offset), keep_palette,
-                forceBmp, gSpriteMode);
-            if (importResult == std::nullopt)
+        for (auto& item : items)
+        {
+            if (item.ImportResult == std::nullopt)
             {
-                fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
+                fprintf(stderr, "Could not import image file: %s\nCanceling\n", item.ImagePath.c_str());
                 return -1;
             }
 
-            spriteFile.AddImage(importResult.value());
+            spriteFile.AddImage(item.ImportResult.value());
 
             if (!silent)
-                fprintf(stdout, "Added: %s\n", imagePath.c_str());
+                fprintf(stdout, "Added: %s\n", item.ImagePath.c_str());
         }
 
         if (!spriteFile.Save(spriteFilePath))
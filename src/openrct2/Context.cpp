@@ -1063,7 +1063,16 @@ namespace OpenRCT2
 
                 _drawingEngine->BeginDraw();
                 _painter->Paint(*_drawingEngine);
-                _drawingEngine->EndDraw();
+
+                // Frames are drawn back to back, so the tail of this frame can overlap with the next game tick
+                if (gConfigGeneral.pipelined_present)
+                {
+                    _drawingEngine->EndDrawPipelined();
+                }
+                else
+                {
+                    _drawingEngine->EndDraw();
+                }
             }
         }
 
@@ -156,7 +156,7 @@ void update_palette_effects()
         {
             palette = water_type->image_id;
         }
-        const rct_g1_element* g1 = gfx_get_g1_element(palette);
+        const rct_g1_element* g1 = gfx_get_g1_element_data(palette);
         if (g1 != nullptr)
         {
             int32_t xoffset = g1->x_offset;
@@ -184,7 +184,7 @@ void update_palette_effects()
                 palette = water_type->image_id;
             }
 
-            const rct_g1_element* g1 = gfx_get_g1_element(palette);
+            const rct_g1_element* g1 = gfx_get_g1_element_data(palette);
             if (g1 != nullptr)
             {
                 int32_t xoffset = g1->x_offset;
@@ -220,7 +220,7 @@ void update_palette_effects()
         {
             waterId = water_type->palette_index_1;
         }
-        const rct_g1_element* g1 = gfx_get_g1_element(shade + waterId);
+        const rct_g1_element* g1 = gfx_get_g1_element_data(shade + waterId);
         if (g1 != nullptr)
         {
             uint8_t* vs = &g1->offset[j * 3];
@@ -245,7 +245,7 @@ void update_palette_effects()
         {
             waterId = water_type->palette_index_2;
         }
-        g1 = gfx_get_g1_element(shade + waterId);
+        g1 = gfx_get_g1_element_data(shade + waterId);
         if (g1 != nullptr)
         {
             uint8_t* vs = &g1->offset[j * 3];
@@ -267,7 +267,7 @@ void update_palette_effects()
 
         j = (static_cast<uint16_t>(gPaletteEffectFrame * -960) * 3) >> 16;
         waterId = SPR_GAME_PALETTE_4;
-        g1 = gfx_get_g1_element(shade + waterId);
+        g1 = gfx_get_g1_element_data(shade + waterId);
         if (g1 != nullptr)
         {
             uint8_t* vs = &g1->offset[j * 3];
@@ -103,6 +103,8 @@ enum class GameCommand : int32_t
     GuestSetFlags,            // GA
     SetDate,                  // GA
     Custom,                   // GA
+    Batch,                    // GA
+    SetTileRegion,            // GA
     Count,
 };
 
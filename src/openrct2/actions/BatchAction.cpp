@@ -0,0 +1,193 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "BatchAction.h"
+
+#include "../management/Finance.h"
+#include "../world/Map.h"
+
+#include <algorithm>
+
+static void AccumulateResult(GameActions::Result& res, const GameActions::Result& subResult)
+{
+    res.Cost += subResult.Cost;
+
+    // The batch is paid for as a whole, so it is booked under the first expenditure type.
+    if (res.Expenditure == ExpenditureType::Count)
+    {
+        res.Expenditure = subResult.Expenditure;
+    }
+    if (res.Position.isNull())
+    {
+        res.Position = subResult.Position;
+    }
+}
+
+bool BatchAction::Add(GameAction::Ptr&& action)
+{
+    if (action == nullptr || !CanBatch(action->GetType()))
+        return false;
+
+    DataSerialiser ds(true);
+    action->Serialise(ds);
+    auto size = static_cast<size_t>(ds.GetStream().GetLength()) + sizeof(GameCommand);
+    if (_serialisedSize + size > MaxSerialisedSize)
+        return false;
+
+    _serialisedSize += size;
+    _actions.push_back(std::move(action));
+    return true;
+}
+
+void BatchAction::Clear()
+{
+    _actions.clear();
+    _serialisedSize = 0;
+}
+
+bool BatchAction::IsEmpty() const
+{
+    return _actions.empty();
+}
+
+size_t BatchAction::GetCount() const
+{
+    return _actions.size();
+}
+
+const std::vector<GameAction::Ptr>& BatchAction::GetActions() const
+{
+    return _actions;
+}
+
+uint32_t BatchAction::GetCooldownTime() const
+{
+    uint32_t cooldownTime = 0;
+    for (const auto& action : _actions)
+    {
+        cooldownTime = std::max(cooldownTime, action->GetCooldownTime());
+    }
+    return cooldownTime;
+}
+
+void BatchAction::Serialise(DataSerialiser& stream)
+{
+    GameAction::Serialise(stream);
+
+    auto count = static_cast<uint32_t>(_actions.size());
+    stream << DS_TAG(count);
+
+    if (stream.IsLoading())
+    {
+        _actions.clear();
+        _serialisedSize = 0;
+
+        // Every action takes up at least a byte, anything larger can not have come from Add.
+        if (count > MaxSerialisedSize)
+            return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        GameCommand type{};
+        if (!stream.IsLoading())
+        {
+            type = _actions[i]->GetType();
+        }
+        stream << DS_TAG(type);
+
+        if (stream.IsLoading())
+        {
+            if (!GameActions::IsValidId(EnumValue(type)) || !CanBatch(type))
+            {
+                // The rest of the stream can not be read without knowing this action, Query rejects the empty batch.
+                _actions.clear();
+                return;
+            }
+            _actions.push_back(GameActions::Create(type));
+        }
+        _actions[i]->Serialise(stream);
+    }
+}
+
+GameActions::Result::Ptr BatchAction::Query() const
+{
+    if (_actions.empty())
+    {
+        return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+    }
+
+    auto res = MakeResult();
+    for (const auto& action : _actions)
+    {
+        if (!CanBatch(action->GetType()))
+        {
+            return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+        }
+
+        PrepareSubAction(*action);
+        auto subResult = GameActions::QueryNested(action.get());
+        if (subResult->Error != GameActions::Status::Ok)
+        {
+            return subResult;
+        }
+        AccumulateResult(*res, *subResult);
+    }
+    return res;
+}
+
+GameActions::Result::Ptr BatchAction::Execute() const
+{
+    auto res = MakeResult();
+
+    // Actions in a batch often touch the same tiles, only redraw each of them once.
+    map_invalidate_begin_batch();
+    for (const auto& action : _actions)
+    {
+        PrepareSubAction(*action);
+        auto subResult = GameActions::ExecuteNested(action.get());
+
+        // Every action was queried against the map as it was before the batch, so an earlier action may have
+        // invalidated this one. Stop here and report the failure, the actions already executed can not be undone.
+        if (subResult->Error != GameActions::Status::Ok)
+        {
+            map_invalidate_end_batch();
+
+            // A failed batch is not paid for by the caller, charge for the actions that did go ahead.
+            if (finance_check_money_required(GetFlags()) && res->Cost != 0)
+            {
+                finance_payment(res->Cost, res->Expenditure);
+            }
+            return subResult;
+        }
+        AccumulateResult(*res, *subResult);
+    }
+    map_invalidate_end_batch();
+
+    return res;
+}
+
+bool BatchAction::CanBatch(GameCommand type)
+{
+    switch (type)
+    {
+        case GameCommand::Batch:
+        case GameCommand::TogglePause:
+        case GameCommand::LoadOrQuit:
+            return false;
+        default:
+            return true;
+    }
+}
+
+void BatchAction::PrepareSubAction(GameAction& action) const
+{
+    action.SetFlags(GetFlags());
+    action.SetPlayer(GetPlayer());
+}
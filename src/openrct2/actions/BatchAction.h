@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameAction.h"
+
+#include <vector>
+
+/**
+ * Carries many game actions so that they are validated together, executed within the same tick and sent over the
+ * network or recorded in a replay as a single action. All sub-actions take on the flags and player of the batch.
+ * Each sub-action is queried against the map as it was before the batch, execution stops at the first sub-action
+ * that fails and the batch returns its result. Sub-actions executed before it are kept.
+ */
+DEFINE_GAME_ACTION(BatchAction, GameCommand::Batch, GameActions::Result)
+{
+public:
+    // Keeps a serialised batch well within the size of a single network packet.
+    static constexpr size_t MaxSerialisedSize = 48 * 1024;
+
+private:
+    std::vector<GameAction::Ptr> _actions;
+    size_t _serialisedSize{};
+
+public:
+    BatchAction() = default;
+
+    /**
+     * Appends an action to the batch, returns false if the action can not be batched or the batch is full.
+     */
+    bool Add(GameAction::Ptr && action);
+    void Clear();
+    bool IsEmpty() const;
+    size_t GetCount() const;
+    const std::vector<GameAction::Ptr>& GetActions() const;
+
+    uint32_t GetCooldownTime() const override;
+
+    void Serialise(DataSerialiser & stream) override;
+    GameActions::Result::Ptr Query() const override;
+    GameActions::Result::Ptr Execute() const override;
+
+    static bool CanBatch(GameCommand type);
+
+private:
+    void PrepareSubAction(GameAction & action) const;
+};
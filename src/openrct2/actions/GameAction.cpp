@@ -572,7 +572,12 @@ bool GameAction::LocationValid(const CoordsXY& coords) const
         return false;
 #ifdef ENABLE_SCRIPTING
     auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
-    if (hookEngine.HasSubscriptions(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION))
+
+    OpenRCT2::Scripting::HookEventInfo info;
+    info.ActionType = _type;
+    info.Player = _playerId;
+    info.Location = coords;
+    if (hookEngine.HasSubscriptions(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION, info))
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
 
@@ -589,7 +594,7 @@ bool GameAction::LocationValid(const CoordsXY& coords) const
 
         // Call the subscriptions
         auto e = obj.Take();
-        hookEngine.Call(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION, e, true);
+        hookEngine.Call(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION, info, e, true);
 
         auto scriptResult = OpenRCT2::Scripting::AsOrDefault(e["result"], true);
 
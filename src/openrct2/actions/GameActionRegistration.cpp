@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 #include "BalloonPressAction.h"
+#include "BatchAction.h"
 #include "BannerPlaceAction.h"
 #include "BannerRemoveAction.h"
 #include "BannerSetColourAction.h"
@@ -78,6 +79,7 @@
 #include "StaffSetPatrolAreaAction.h"
 #include "SurfaceSetStyleAction.h"
 #include "TileModifyAction.h"
+#include "TileRegionSetAction.h"
 #include "TrackDesignAction.h"
 #include "TrackPlaceAction.h"
 #include "TrackRemoveAction.h"
@@ -159,6 +161,7 @@ namespace GameActions
         Register<LandSetRightsAction>();
         Register<LandSmoothAction>();
         Register<TileModifyAction>();
+        Register<TileRegionSetAction>();
         Register<TrackDesignAction>();
         Register<TrackPlaceAction>();
         Register<TrackRemoveAction>();
@@ -172,6 +175,7 @@ namespace GameActions
         Register<GuestSetFlagsAction>();
         Register<ParkSetDateAction>();
         Register<SetCheatAction>();
+        Register<BatchAction>();
 #ifdef ENABLE_SCRIPTING
         Register<CustomAction>();
 #endif
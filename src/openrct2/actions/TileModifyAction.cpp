@@ -51,6 +51,12 @@ GameActions::Result::Ptr TileModifyAction::QueryExecute(bool isExecuting) const
     {
         return MakeResult(GameActions::Status::InvalidParameters, STR_LAND_NOT_OWNED_BY_PARK);
     }
+    if (isExecuting)
+    {
+        // The tile inspector edits elements in place
+        MarkTileElementsChanged(TileCoordsXY{ _loc });
+    }
+
     auto res = MakeResult();
     switch (_setting)
     {
@@ -0,0 +1,152 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TileRegionSetAction.h"
+
+#include "../world/Map.h"
+
+TileRegionSetAction::TileRegionSetAction(
+    const MapRange& range, std::vector<uint16_t>&& counts, std::vector<TileElement>&& elements)
+    : _range(range)
+    , _counts(std::move(counts))
+    , _elements(std::move(elements))
+{
+}
+
+uint16_t TileRegionSetAction::GetActionFlags() const
+{
+    return GameAction::GetActionFlags() | GameActions::Flags::AllowWhilePaused;
+}
+
+void TileRegionSetAction::Serialise(DataSerialiser& stream)
+{
+    GameAction::Serialise(stream);
+
+    stream << DS_TAG(_range) << DS_TAG(_counts) << DS_TAG(_elements);
+}
+
+GameActions::Result::Ptr TileRegionSetAction::Query() const
+{
+    auto res = MakeResult();
+    res->Position = { _range.GetLeft() + COORDS_XY_HALF_TILE, _range.GetTop() + COORDS_XY_HALF_TILE, 0 };
+
+    if (_range.GetLeft() % COORDS_XY_STEP != 0 || _range.GetTop() % COORDS_XY_STEP != 0
+        || _range.GetRight() % COORDS_XY_STEP != 0 || _range.GetBottom() % COORDS_XY_STEP != 0
+        || _range.GetLeft() > _range.GetRight() || _range.GetTop() > _range.GetBottom())
+    {
+        return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+    }
+    if (!map_is_location_valid(_range.Point1) || !map_is_location_valid(_range.Point2))
+    {
+        return MakeResult(GameActions::Status::InvalidParameters, STR_OFF_EDGE_OF_MAP);
+    }
+
+    auto numTilesX = static_cast<size_t>((_range.GetRight() - _range.GetLeft()) / COORDS_XY_STEP + 1);
+    auto numTilesY = static_cast<size_t>((_range.GetBottom() - _range.GetTop()) / COORDS_XY_STEP + 1);
+    if (_counts.size() != numTilesX * numTilesY || _elements.size() > MaxElements)
+    {
+        return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+    }
+
+    size_t elementIndex = 0;
+    size_t tileIndex = 0;
+    size_t numExtraElements = 0;
+    for (int32_t y = _range.GetTop(); y <= _range.GetBottom(); y += COORDS_XY_STEP)
+    {
+        for (int32_t x = _range.GetLeft(); x <= _range.GetRight(); x += COORDS_XY_STEP)
+        {
+            const CoordsXY loc{ x, y };
+            if (!LocationValid(loc))
+            {
+                return MakeResult(GameActions::Status::InvalidParameters, STR_LAND_NOT_OWNED_BY_PARK);
+            }
+
+            auto numElements = static_cast<size_t>(_counts[tileIndex++]);
+            if (numElements == 0 || elementIndex + numElements > _elements.size())
+            {
+                return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+            }
+
+            // Every tile has to keep its surface, much of the game relies on it being there.
+            size_t numSurfaces = 0;
+            for (size_t i = 0; i < numElements; i++)
+            {
+                if (_elements[elementIndex + i].GetType() == TILE_ELEMENT_TYPE_SURFACE)
+                {
+                    numSurfaces++;
+                }
+            }
+            if (numSurfaces != 1)
+            {
+                return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+            }
+
+            auto* tileElement = map_get_first_element_at(loc);
+            size_t numElementsOnTile = 0;
+            if (tileElement != nullptr)
+            {
+                do
+                {
+                    numElementsOnTile++;
+                } while (!(tileElement++)->IsLastForTile());
+            }
+            if (numElements > numElementsOnTile)
+            {
+                numExtraElements += numElements - numElementsOnTile;
+            }
+            elementIndex += numElements;
+        }
+    }
+    if (elementIndex != _elements.size())
+    {
+        return MakeResult(GameActions::Status::InvalidParameters, STR_NONE);
+    }
+
+    // Each tile on its own may fit while the region as a whole does not, so check the capacity for all of it at once.
+    const CoordsXY topLeft{ _range.GetLeft(), _range.GetTop() };
+    if (numExtraElements != 0 && !MapCheckCapacityAndReorganise(topLeft, numExtraElements))
+    {
+        return MakeResult(GameActions::Status::NoFreeElements, STR_NONE, STR_ERR_LANDSCAPE_DATA_AREA_FULL);
+    }
+    return res;
+}
+
+GameActions::Result::Ptr TileRegionSetAction::Execute() const
+{
+    auto res = MakeResult();
+    res->Position = { _range.GetLeft() + COORDS_XY_HALF_TILE, _range.GetTop() + COORDS_XY_HALF_TILE, 0 };
+
+    map_invalidate_begin_batch();
+    size_t elementIndex = 0;
+    size_t tileIndex = 0;
+    for (int32_t y = _range.GetTop(); y <= _range.GetBottom(); y += COORDS_XY_STEP)
+    {
+        for (int32_t x = _range.GetLeft(); x <= _range.GetRight(); x += COORDS_XY_STEP)
+        {
+            const CoordsXY loc{ x, y };
+            auto numElements = static_cast<size_t>(_counts[tileIndex++]);
+
+            map_invalidate_tile_full(loc);
+            if (!map_replace_tile_elements(TileCoordsXY(loc), &_elements[elementIndex], numElements))
+            {
+                res = MakeResult(GameActions::Status::NoFreeElements, STR_NONE, STR_ERR_LANDSCAPE_DATA_AREA_FULL);
+                break;
+            }
+            map_invalidate_tile_full(loc);
+            elementIndex += numElements;
+        }
+        if (res->Error != GameActions::Status::Ok)
+        {
+            break;
+        }
+    }
+    map_invalidate_end_batch();
+
+    return res;
+}
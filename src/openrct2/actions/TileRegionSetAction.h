@@ -0,0 +1,40 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameAction.h"
+
+#include <vector>
+
+/**
+ * Replaces the elements of every tile in a rectangle. Tiles are stored row by row, each with its number of elements
+ * in counts followed by its elements in elements.
+ */
+DEFINE_GAME_ACTION(TileRegionSetAction, GameCommand::SetTileRegion, GameActions::Result)
+{
+public:
+    // Keeps a serialised region well within the size of a single network packet.
+    static constexpr size_t MaxElements = 3072;
+
+private:
+    MapRange _range;
+    std::vector<uint16_t> _counts;
+    std::vector<TileElement> _elements;
+
+public:
+    TileRegionSetAction() = default;
+    TileRegionSetAction(const MapRange& range, std::vector<uint16_t>&& counts, std::vector<TileElement>&& elements);
+
+    uint16_t GetActionFlags() const override;
+
+    void Serialise(DataSerialiser & stream) override;
+    GameActions::Result::Ptr Query() const override;
+    GameActions::Result::Ptr Execute() const override;
+};
@@ -0,0 +1,136 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../localisation/Formatter.h"
+#    include "../localisation/Localisation.h"
+#    include "../localisation/StringIds.h"
+#    include "../platform/platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <functional>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+struct BenchFormatCase
+{
+    const char* Name;
+    rct_string_id StringId;
+    std::function<void(Formatter&)> AddArgs;
+};
+
+// A selection of the strings drawn most often by windows and scrolling lists
+static const std::vector<BenchFormatCase> _benchFormatCases = {
+    { "literal", STR_CLOSE_WINDOW_TIP, [](Formatter&) {} },
+    { "integer", STR_FORMAT_INTEGER, [](Formatter& ft) { ft.Add<int32_t>(1234567); } },
+    { "comma16", STR_COMMA16, [](Formatter& ft) { ft.Add<int16_t>(12345); } },
+    { "park_rating_label", STR_PARK_RATING_LABEL, [](Formatter& ft) { ft.Add<int16_t>(750); } },
+    { "guests_in_park_label", STR_GUESTS_IN_PARK_LABEL, [](Formatter& ft) { ft.Add<int32_t>(2500); } },
+    { "currency_label", STR_CURRENCY_FORMAT_LABEL, [](Formatter& ft) { ft.Add<money32>(MONEY(12345, 67)); } },
+    { "date", STR_DATE_FORMAT_MY, [](Formatter& ft) { ft.Add<uint16_t>(3).Add<uint16_t>(12); } },
+    { "nested_stringid",
+      STR_WINDOW_COLOUR_2_STRINGID,
+      [](Formatter& ft) { ft.Add<rct_string_id>(STR_GUESTS_IN_PARK_LABEL).Add<int32_t>(2500); } },
+    { "nested_literal", STR_STRINGID, [](Formatter& ft) { ft.Add<rct_string_id>(STR_GUESTS); } },
+};
+
+static void BM_format(benchmark::State& state, const BenchFormatCase& benchCase)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        Formatter ft;
+        benchCase.AddArgs(ft);
+
+        char buffer[512];
+        for (auto _ : state)
+        {
+            format_string(buffer, sizeof(buffer), benchCase.StringId, ft.Data());
+            benchmark::DoNotOptimize(buffer);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    else
+    {
+        state.SkipWithError("Context initialization failed.");
+    }
+}
+
+static int CmdlineForBenchFormat(int argc, const char* const* argv)
+{
+    for (const auto& benchCase : _benchFormatCases)
+    {
+        benchmark::RegisterBenchmark(benchCase.Name, BM_format, benchCase);
+    }
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchFormat(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchFormat(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchFormat(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchFormatCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchFormat),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchFormat), CommandTableEnd
+#endif // USE_BENCHMARK
+};
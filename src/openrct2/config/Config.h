@@ -42,6 +42,8 @@ struct GeneralConfiguration
     bool use_vsync;
     bool show_fps;
     bool multithreading;
+    bool pipelined_present;
+    int32_t object_image_budget_mb;
     bool minimize_fullscreen_focus_loss;
     bool disable_screensaver;
 
@@ -208,6 +210,7 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    int32_t tick_budget_ms;
 };
 
 enum class Sort : int32_t
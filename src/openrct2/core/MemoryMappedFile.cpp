@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+namespace OpenRCT2
+{
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+#ifdef _WIN32
+        auto pathW = String::ToWideChar(path);
+        auto file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            throw IOException(String::StdFormat("Unable to get the size of '%s'", path.c_str()));
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+
+        // An empty file can not be mapped, there is nothing to read from it anyway
+        if (_size != 0)
+        {
+            // The view keeps the mapping alive, so neither handle is needed once it has been created
+            auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                _data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#else
+        auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+        {
+            close(fd);
+            throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+        }
+        _size = static_cast<size_t>(fileStat.st_size);
+
+        // An empty file can not be mapped, there is nothing to read from it anyway
+        if (_size != 0)
+        {
+            // The mapping stays valid after the file is closed
+            auto data = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                _data = static_cast<const uint8_t*>(data);
+            }
+        }
+        close(fd);
+#endif
+        if (_size != 0 && _data == nullptr)
+        {
+            throw IOException(String::StdFormat("Unable to map '%s' into memory", path.c_str()));
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (_data != nullptr)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(_data);
+#else
+            munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+        }
+    }
+
+    const uint8_t* MemoryMappedFile::GetData() const
+    {
+        return _data;
+    }
+
+    size_t MemoryMappedFile::GetSize() const
+    {
+        return _size;
+    }
+
+} // namespace OpenRCT2
@@ -42,6 +42,77 @@ void mask_avx2(
     }
 }
 
+void palette_expand_avx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette)
+{
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        const __m256i colours = _mm256_i32gather_epi32(reinterpret_cast<const int*>(palette), indices, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), colours);
+    }
+    palette_expand_scalar(src + i, dst + i, count - i, palette);
+}
+
+void palette_expand_light_avx2(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette)
+{
+    // Spreads the intensity of each pixel over its four channels, first and second group of four pixels
+    const __m128i intensityShuffleLo = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+    const __m128i intensityShuffleHi = _mm_setr_epi8(4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+    const __m256i intensityScale = _mm256_set1_epi16(6);
+
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        const __m256i dark = _mm256_i32gather_epi32(reinterpret_cast<const int*>(palette), indices, 4);
+        const __m256i light = _mm256_i32gather_epi32(reinterpret_cast<const int*>(lightPalette), indices, 4);
+
+        const __m128i intensity8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lightSrc + i));
+        const __m256i intensityLo = _mm256_mullo_epi16(
+            _mm256_cvtepu8_epi16(_mm_shuffle_epi8(intensity8, intensityShuffleLo)), intensityScale);
+        const __m256i intensityHi = _mm256_mullo_epi16(
+            _mm256_cvtepu8_epi16(_mm_shuffle_epi8(intensity8, intensityShuffleHi)), intensityScale);
+
+        // (light * intensity) >> 8 is the high half of (light << 8) * intensity
+        const __m256i lightLo = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(light)), 8);
+        const __m256i lightHi = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(light, 1)), 8);
+        const __m256i mixLo = _mm256_add_epi16(
+            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(dark)), _mm256_mulhi_epu16(lightLo, intensityLo));
+        const __m256i mixHi = _mm256_add_epi16(
+            _mm256_cvtepu8_epi16(_mm256_extracti128_si256(dark, 1)), _mm256_mulhi_epu16(lightHi, intensityHi));
+
+        // Packing works per 128-bit lane, so the pixel pairs come out as 0 1 4 5 2 3 6 7
+        const __m256i packed = _mm256_packus_epi16(mixLo, mixHi);
+        const __m256i colours = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), colours);
+    }
+    palette_expand_light_scalar(src + i, lightSrc + i, dst + i, count - i, palette, lightPalette);
+}
+
+void light_add_avx2(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale)
+{
+    const __m256i scale16 = _mm256_set1_epi16(static_cast<int16_t>(scale));
+
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i light = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i lightLo = _mm256_srli_epi16(
+            _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(light)), scale16), 8);
+        const __m256i lightHi = _mm256_srli_epi16(
+            _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(light, 1)), scale16), 8);
+
+        // Packing works per 128-bit lane, so the halves come out as 0 2 1 3
+        const __m256i scaled = _mm256_permute4x64_epi64(_mm256_packus_epi16(lightLo, lightHi), _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epu8(current, scaled));
+    }
+    light_add_scalar(dst + i, src + i, count - i, scale);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +126,21 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void palette_expand_avx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void palette_expand_light_avx2(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void light_add_avx2(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -188,6 +188,32 @@ static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Maps the element data that follows the current position of the stream, so that it is only paged in once drawn
+ * and shared between every process using the same file. Falls back to reading it into memory.
+ */
+static const uint8_t* gfx_load_gx_data(rct_gx& gx, const std::string& path, IStream& stream)
+{
+    auto dataOffset = stream.GetPosition();
+    try
+    {
+        auto mappedFile = std::make_unique<MemoryMappedFile>(path);
+        if (mappedFile->GetSize() >= dataOffset + gx.header.total_size)
+        {
+            gx.mappedFile = std::move(mappedFile);
+            return gx.mappedFile->GetData() + dataOffset;
+        }
+    }
+    catch (const IOException& e)
+    {
+        log_verbose("Unable to map graphics file, reading it instead: %s", e.what());
+    }
+
+    // Also reached for truncated files, where reading throws just as it always has
+    gx.data = stream.ReadArray<uint8_t>(gx.header.total_size);
+    return gx.data.get();
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -215,12 +241,12 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto data = gfx_load_gx_data(_g1, path, fs);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -241,6 +267,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
+    _g1.mappedFile.reset();
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -248,6 +275,7 @@ void gfx_unload_g1()
 
 void gfx_unload_g2()
 {
+    _g2.mappedFile.reset();
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -255,6 +283,7 @@ void gfx_unload_g2()
 
 void gfx_unload_csg()
 {
+    _csg.mappedFile.reset();
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -278,12 +307,12 @@ bool gfx_load_g2()
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto data = gfx_load_gx_data(_g2, path, fs);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -335,12 +364,12 @@ bool gfx_load_csg()
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto data = gfx_load_gx_data(_csg, pathDataPath, fileData);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -431,7 +460,7 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
     int32_t x = coords.x;
     int32_t y = coords.y;
 
-    const auto* g1 = gfx_get_g1_element(imageId);
+    const auto* g1 = gfx_get_g1_element_data(imageId);
     if (g1 == nullptr)
     {
         return;
@@ -601,8 +630,8 @@ void FASTCALL gfx_draw_sprite_raw_masked_software(
     rct_drawpixelinfo* dpi, const ScreenCoordsXY& scrCoords, int32_t maskImage, int32_t colourImage)
 {
     int32_t left, top, right, bottom, width, height;
-    auto imgMask = gfx_get_g1_element(maskImage & 0x7FFFF);
-    auto imgColour = gfx_get_g1_element(colourImage & 0x7FFFF);
+    auto imgMask = gfx_get_g1_element_data(maskImage & 0x7FFFF);
+    auto imgColour = gfx_get_g1_element_data(colourImage & 0x7FFFF);
     if (imgMask == nullptr || imgColour == nullptr)
     {
         return;
@@ -722,6 +751,28 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
     return nullptr;
 }
 
+const rct_g1_element* gfx_get_g1_element_data(ImageId imageId)
+{
+    return gfx_get_g1_element_data(imageId.GetIndex());
+}
+
+/**
+ * Gets an element in order to read its pixel data. Object images released to stay within the image memory budget are
+ * loaded back in first, so unlike gfx_get_g1_element this returns nullptr if that is not possible.
+ */
+const rct_g1_element* gfx_get_g1_element_data(int32_t image_id)
+{
+    auto g1 = gfx_get_g1_element(image_id);
+    if (g1 != nullptr && image_id >= SPR_IMAGE_LIST_BEGIN && image_id < SPR_IMAGE_LIST_END)
+    {
+        if (!gfx_object_make_image_resident(static_cast<uint32_t>(image_id)))
+        {
+            return nullptr;
+        }
+    }
+    return g1;
+}
+
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
 {
     bool isTemp = imageId == SPR_TEMP;
@@ -20,6 +20,7 @@
 #include "../world/Location.hpp"
 #include "../world/Water.h"
 
+#include <algorithm>
 #include <cstring>
 
 const PaletteMap& PaletteMap::GetDefault()
@@ -571,6 +572,109 @@ void mask_init()
     }
 }
 
+void (*palette_expand_fn)(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette)
+    = nullptr;
+
+void (*palette_expand_light_fn)(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette)
+    = nullptr;
+
+void palette_expand_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 palette expand functions");
+        palette_expand_fn = palette_expand_avx2;
+        palette_expand_light_fn = palette_expand_light_avx2;
+    }
+    else if (sse41_available())
+    {
+        // There is no gather before AVX2, only the light mixing benefits from SSE4.1
+        log_verbose("registering SSE4.1 palette expand functions");
+        palette_expand_fn = palette_expand_scalar;
+        palette_expand_light_fn = palette_expand_light_sse4_1;
+    }
+    else
+    {
+        log_verbose("registering scalar palette expand functions");
+        palette_expand_fn = palette_expand_scalar;
+        palette_expand_light_fn = palette_expand_light_scalar;
+    }
+}
+
+void palette_expand_scalar(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = palette[src[i]];
+    }
+}
+
+static uint8_t mix_light(uint32_t a, uint32_t b, uint32_t intensity)
+{
+    intensity = intensity * 6;
+    uint32_t bMul = (b * intensity) >> 8;
+    uint32_t ab = a + bMul;
+    uint8_t result = std::min<uint32_t>(255, ab);
+    return result;
+}
+
+void palette_expand_light_scalar(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        uint32_t darkColour = palette[src[i]];
+        uint32_t lightColour = lightPalette[src[i]];
+        uint8_t lightIntensity = lightSrc[i];
+
+        uint32_t colour = 0;
+        if (lightIntensity == 0)
+        {
+            colour = darkColour;
+        }
+        else
+        {
+            colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+            colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+            colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+            colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+        }
+        dst[i] = colour;
+    }
+}
+
+void (*light_add_fn)(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale) = nullptr;
+
+void light_add_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 light add function");
+        light_add_fn = light_add_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 light add function");
+        light_add_fn = light_add_sse4_1;
+    }
+    else
+    {
+        log_verbose("registering scalar light add function");
+        light_add_fn = light_add_scalar;
+    }
+}
+
+void light_add_scalar(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = std::min<uint32_t>(0xFF, dst[i] + ((src[i] * scale) >> 8));
+    }
+}
+
 void gfx_filter_pixel(rct_drawpixelinfo* dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     gfx_filter_rect(dpi, { coords, coords }, palette);
@@ -584,7 +688,7 @@ void gfx_filter_pixel(rct_drawpixelinfo* dpi, const ScreenCoordsXY& coords, Filt
  */
 void gfx_transpose_palette(int32_t pal, uint8_t product)
 {
-    const rct_g1_element* g1 = gfx_get_g1_element(pal);
+    const rct_g1_element* g1 = gfx_get_g1_element_data(pal);
     if (g1 != nullptr)
     {
         int32_t width = g1->width;
@@ -625,7 +729,7 @@ void load_palette()
         palette = water_type->image_id;
     }
 
-    const rct_g1_element* g1 = gfx_get_g1_element(palette);
+    const rct_g1_element* g1 = gfx_get_g1_element_data(palette);
     if (g1 != nullptr)
     {
         int32_t width = g1->width;
@@ -11,6 +11,7 @@
 #define _DRAWING_H_
 
 #include "../common.h"
+#include "../core/MemoryMappedFile.h"
 #include "../interface/Colour.h"
 #include "../interface/ZoomLevel.h"
 #include "../world/Location.hpp"
@@ -99,9 +100,27 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
+    // Element data is either mapped straight from the file or, where that is not possible, read into memory.
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> mappedFile;
     std::unique_ptr<uint8_t[]> data;
 };
 
+/**
+ * Where an allocated list of object images gets its pixel data from, so that the data can be released while the
+ * images are not being drawn and loaded back in once they are.
+ */
+struct IImageListSource
+{
+    virtual ~IImageListSource() = default;
+
+    /**
+     * Loads the pixel data back in, returns the images with their data or nullptr if they can no longer be loaded.
+     */
+    virtual const rct_g1_element* LoadImages() abstract;
+    virtual void UnloadImages() abstract;
+    virtual size_t GetImageDataSize() const abstract;
+};
+
 struct rct_drawpixelinfo
 {
     uint8_t* bits{};
@@ -707,10 +726,14 @@ void gfx_unload_g2();
 void gfx_unload_csg();
 const rct_g1_element* gfx_get_g1_element(ImageId imageId);
 const rct_g1_element* gfx_get_g1_element(int32_t image_id);
+const rct_g1_element* gfx_get_g1_element_data(ImageId imageId);
+const rct_g1_element* gfx_get_g1_element_data(int32_t image_id);
 void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1);
 bool is_csg_loaded();
-uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count);
+uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count, IImageListSource* source = nullptr);
 void gfx_object_free_images(uint32_t baseImageId, uint32_t count);
+bool gfx_object_make_image_resident(uint32_t imageId);
+void gfx_object_update_image_residency();
 void gfx_object_check_all_images_freed();
 size_t ImageListGetUsedCount();
 size_t ImageListGetMaximum();
@@ -786,6 +809,43 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+void palette_expand_scalar(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette);
+void palette_expand_avx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette);
+void palette_expand_light_scalar(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette);
+void palette_expand_light_sse4_1(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette);
+void palette_expand_light_avx2(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette);
+void palette_expand_init();
+
+/**
+ * Converts a row of 8-bit palette indices into 32-bit colours using a pre-mapped palette.
+ */
+extern void (*palette_expand_fn)(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, int32_t count, const uint32_t* RESTRICT palette);
+
+/**
+ * Same as palette_expand_fn, but additively mixes in the light palette colour scaled by the light intensity of each pixel.
+ */
+extern void (*palette_expand_light_fn)(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette);
+
+void light_add_scalar(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale);
+void light_add_sse4_1(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale);
+void light_add_avx2(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale);
+void light_add_init();
+
+/**
+ * Adds a row of light texture, scaled by scale / 256, onto a row of the light buffer, saturating at 255.
+ */
+extern void (*light_add_fn)(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 
@@ -32,6 +32,11 @@ enum DRAWING_ENGINE_FLAGS
      * Whether or not the engine will only draw changed blocks of the screen each frame.
      */
     DEF_DIRTY_OPTIMISATIONS = 1 << 0,
+
+    /**
+     * Whether or not separate areas of the screen can be drawn from multiple threads at the same time.
+     */
+    DEF_PARALLEL_DRAWING = 1 << 1,
 };
 
 struct rct_drawpixelinfo;
@@ -61,6 +66,13 @@ namespace OpenRCT2::Drawing
         virtual void Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom) abstract;
         virtual void BeginDraw() abstract;
         virtual void EndDraw() abstract;
+
+        /**
+         * Same as EndDraw, but the engine may leave the frame to be finished on a worker thread so that it overlaps
+         * with the game logic of the next frame. The frame is presented at the latest by the next call to BeginDraw.
+         */
+        virtual void EndDrawPipelined() abstract;
+
         virtual void PaintWindows() abstract;
         virtual void PaintWeather() abstract;
         virtual void CopyRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy) abstract;
@@ -8,13 +8,18 @@
  *****************************************************************************/
 
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Guard.hpp"
 #include "../sprites.h"
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 constexpr uint32_t BASE_IMAGE_ID = SPR_IMAGE_LIST_BEGIN;
 constexpr uint32_t MAX_IMAGES = SPR_IMAGE_LIST_END - BASE_IMAGE_ID;
@@ -26,10 +31,31 @@ struct ImageList
     uint32_t Count;
 };
 
+/**
+ * An allocated image list whose pixel data can be released to stay within the image memory budget.
+ */
+struct PagedImageList
+{
+    uint32_t BaseId{};
+    uint32_t Count{};
+    IImageListSource* Source{};
+    size_t DataSize{};
+    std::atomic<uint32_t> LastUsed{};
+    std::atomic_bool Resident{ true };
+    bool Failed{};
+};
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+// Images are drawn on several threads, lists are only released between frames but can be loaded in during one.
+static std::mutex _pagedImageListsMutex;
+static std::vector<std::unique_ptr<PagedImageList>> _pagedImageLists;
+// For each allocated image, its index into _pagedImageLists plus one or zero if its list is always kept in memory
+static std::vector<uint32_t> _pagedImageListIndices;
+static size_t _residentImageDataSize;
+
 #ifdef DEBUG
 static std::list<ImageList> _allocatedLists;
 
@@ -187,7 +213,95 @@ static void FreeImageList(uint32_t baseImageId, uint32_t count)
     _freeLists.push_back({ baseImageId, count });
 }
 
-uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count)
+static void RegisterPagedImageList(uint32_t baseImageId, uint32_t count, IImageListSource* source)
+{
+    auto dataSize = source->GetImageDataSize();
+    if (dataSize == 0)
+        return;
+
+    auto list = std::make_unique<PagedImageList>();
+    list->BaseId = baseImageId;
+    list->Count = count;
+    list->Source = source;
+    list->DataSize = dataSize;
+    list->LastUsed = gCurrentDrawCount;
+
+    std::lock_guard<std::mutex> lock(_pagedImageListsMutex);
+    auto it = std::find(_pagedImageLists.begin(), _pagedImageLists.end(), nullptr);
+    if (it == _pagedImageLists.end())
+    {
+        it = _pagedImageLists.insert(it, nullptr);
+    }
+    *it = std::move(list);
+
+    auto firstIndex = baseImageId - BASE_IMAGE_ID;
+    if (_pagedImageListIndices.size() < firstIndex + count)
+    {
+        _pagedImageListIndices.resize(firstIndex + count);
+    }
+    auto listIndex = static_cast<uint32_t>(std::distance(_pagedImageLists.begin(), it)) + 1;
+    std::fill_n(_pagedImageListIndices.begin() + firstIndex, count, listIndex);
+    _residentImageDataSize += dataSize;
+}
+
+static void UnregisterPagedImageList(uint32_t baseImageId, uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(_pagedImageListsMutex);
+    auto firstIndex = baseImageId - BASE_IMAGE_ID;
+    if (firstIndex >= _pagedImageListIndices.size() || _pagedImageListIndices[firstIndex] == 0)
+        return;
+
+    auto& list = _pagedImageLists[_pagedImageListIndices[firstIndex] - 1];
+    if (list->Resident)
+    {
+        _residentImageDataSize -= list->DataSize;
+    }
+    std::fill_n(_pagedImageListIndices.begin() + firstIndex, count, 0);
+    list = nullptr;
+}
+
+static bool LoadPagedImageList(PagedImageList& list)
+{
+    std::lock_guard<std::mutex> lock(_pagedImageListsMutex);
+
+    // Another thread may have loaded the list while this one waited
+    if (list.Resident)
+        return true;
+    if (list.Failed)
+        return false;
+
+    auto images = list.Source->LoadImages();
+    if (images == nullptr)
+    {
+        log_error("Unable to load images %u to %u back in.", list.BaseId, list.BaseId + list.Count - 1);
+        list.Failed = true;
+        return false;
+    }
+
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        gfx_set_g1_element(list.BaseId + i, &images[i]);
+    }
+    _residentImageDataSize += list.DataSize;
+    list.Resident = true;
+    return true;
+}
+
+static void UnloadPagedImageList(PagedImageList& list)
+{
+    // Clear the data of the elements before releasing it, the rest of each element is still needed for layout
+    for (uint32_t i = 0; i < list.Count; i++)
+    {
+        auto g1 = *gfx_get_g1_element(list.BaseId + i);
+        g1.offset = nullptr;
+        gfx_set_g1_element(list.BaseId + i, &g1);
+    }
+    list.Resident = false;
+    list.Source->UnloadImages();
+    _residentImageDataSize -= list.DataSize;
+}
+
+uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count, IImageListSource* source)
 {
     if (count == 0 || gOpenRCT2NoGraphics)
     {
@@ -209,6 +323,10 @@ uint32_t gfx_object_allocate_images(const rct_g1_element* images, uint32_t count
         imageId++;
     }
 
+    if (source != nullptr)
+    {
+        RegisterPagedImageList(baseImageId, count, source);
+    }
     return baseImageId;
 }
 
@@ -216,6 +334,8 @@ void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != INVALID_IMAGE_ID)
     {
+        UnregisterPagedImageList(baseImageId, count);
+
         // Zero the G1 elements so we don't have invalid pointers
         // and data lying about
         for (uint32_t i = 0; i < count; i++)
@@ -230,6 +350,55 @@ void gfx_object_free_images(uint32_t baseImageId, uint32_t count)
     }
 }
 
+/**
+ * Loads back in the pixel data of the list the image belongs to if it had been released, returns false if that
+ * failed and the image can not be drawn.
+ */
+bool gfx_object_make_image_resident(uint32_t imageId)
+{
+    auto index = imageId - BASE_IMAGE_ID;
+    if (index >= _pagedImageListIndices.size() || _pagedImageListIndices[index] == 0)
+        return true;
+
+    auto& list = *_pagedImageLists[_pagedImageListIndices[index] - 1];
+    list.LastUsed.store(gCurrentDrawCount, std::memory_order_relaxed);
+    if (list.Resident)
+        return true;
+    return LoadPagedImageList(list);
+}
+
+/**
+ * Releases the pixel data of the image lists that have gone the longest without being drawn until the data left
+ * fits in the image memory budget. Must only be called between frames.
+ */
+void gfx_object_update_image_residency()
+{
+    auto budget = static_cast<size_t>(std::max(gConfigGeneral.object_image_budget_mb, 0)) * 1024 * 1024;
+    if (budget == 0 || _residentImageDataSize <= budget)
+        return;
+
+    std::lock_guard<std::mutex> lock(_pagedImageListsMutex);
+    std::vector<PagedImageList*> candidates;
+    for (const auto& list : _pagedImageLists)
+    {
+        // Lists drawn in the current frame are likely to be drawn in the next one too
+        if (list != nullptr && list->Resident && list->LastUsed != gCurrentDrawCount)
+        {
+            candidates.push_back(list.get());
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const PagedImageList* a, const PagedImageList* b) {
+        return a->LastUsed < b->LastUsed;
+    });
+
+    for (auto* list : candidates)
+    {
+        if (_residentImageDataSize <= budget)
+            break;
+        UnloadPagedImageList(*list);
+    }
+}
+
 void gfx_object_check_all_images_freed()
 {
     if (_allocatedImageCount != 0)
@@ -11,15 +11,163 @@
 
 #include "../core/Imaging.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 using namespace OpenRCT2::Drawing;
 using ImportResult = ImageImporter::ImportResult;
 
 constexpr int32_t PALETTE_TRANSPARENT = -1;
 
+/**
+ * Precomputed lookups into a palette so that each pixel does not need a scan over every palette entry. Both give
+ * exactly the same index as the equivalent linear scan, including which entry wins when several are equally close.
+ */
+class ImageImporter::PaletteLookup
+{
+private:
+    // Each cell of the nearest colour grid covers 8 values of every channel.
+    static constexpr int32_t CellShift = 3;
+    static constexpr int32_t CellsPerAxis = 256 >> CellShift;
+
+    const GamePalette& _palette;
+    std::unordered_map<uint32_t, uint8_t> _exactMatches;
+    std::vector<uint8_t> _changeableIndices;
+
+    // The palette indices that can be closest to a colour within each cell, in ascending order.
+    std::vector<uint32_t> _cellStart;
+    std::vector<uint8_t> _cellCandidates;
+
+public:
+    explicit PaletteLookup(const GamePalette& palette)
+        : _palette(palette)
+    {
+        for (int32_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            // Duplicate colours keep their first index, like a linear scan would
+            auto colour = PackColour(palette[i].Red, palette[i].Green, palette[i].Blue);
+            _exactMatches.emplace(colour, static_cast<uint8_t>(i));
+            if (IsChangablePixel(i))
+            {
+                _changeableIndices.push_back(static_cast<uint8_t>(i));
+            }
+        }
+        BuildGrid();
+    }
+
+    int32_t FindExact(const int16_t* colour) const
+    {
+        if (!IsInRange(colour))
+            return PALETTE_TRANSPARENT;
+
+        auto it = _exactMatches.find(PackColour(colour[0], colour[1], colour[2]));
+        return it != _exactMatches.end() ? it->second : PALETTE_TRANSPARENT;
+    }
+
+    int32_t FindClosest(const int16_t* colour) const
+    {
+        // Dithering can push a colour outside of the grid, those fall back to checking every entry
+        if (!IsInRange(colour))
+            return FindClosest(colour, _changeableIndices.data(), _changeableIndices.size());
+
+        auto cell = GetCellIndex(colour[0] >> CellShift, colour[1] >> CellShift, colour[2] >> CellShift);
+        auto start = _cellStart[cell];
+        return FindClosest(colour, _cellCandidates.data() + start, _cellStart[cell + 1] - start);
+    }
+
+private:
+    static uint32_t PackColour(int32_t red, int32_t green, int32_t blue)
+    {
+        return (red << 16) | (green << 8) | blue;
+    }
+
+    static bool IsInRange(const int16_t* colour)
+    {
+        return std::all_of(colour, colour + 3, [](int16_t channel) { return channel >= 0 && channel <= 255; });
+    }
+
+    static size_t GetCellIndex(int32_t red, int32_t green, int32_t blue)
+    {
+        return (static_cast<size_t>(red) * CellsPerAxis + green) * CellsPerAxis + blue;
+    }
+
+    void BuildGrid()
+    {
+        constexpr int32_t cellSize = 1 << CellShift;
+        constexpr size_t numCells = CellsPerAxis * CellsPerAxis * CellsPerAxis;
+
+        _cellStart.reserve(numCells + 1);
+        std::vector<uint32_t> minErrors(_changeableIndices.size());
+        for (int32_t red = 0; red < CellsPerAxis; red++)
+        {
+            for (int32_t green = 0; green < CellsPerAxis; green++)
+            {
+                for (int32_t blue = 0; blue < CellsPerAxis; blue++)
+                {
+                    const int32_t low[] = { red * cellSize, green * cellSize, blue * cellSize };
+
+                    // No colour in the cell is further than maxError from the entry with the lowest maxError, so
+                    // entries that can not get any closer than that are never the closest.
+                    auto bound = std::numeric_limits<uint32_t>::max();
+                    for (size_t i = 0; i < _changeableIndices.size(); i++)
+                    {
+                        const auto& entry = _palette[_changeableIndices[i]];
+                        const int32_t channels[] = { entry.Red, entry.Green, entry.Blue };
+
+                        uint32_t minError = 0;
+                        uint32_t maxError = 0;
+                        for (int32_t c = 0; c < 3; c++)
+                        {
+                            auto high = low[c] + cellSize - 1;
+                            auto nearest = std::clamp(channels[c], low[c], high) - channels[c];
+                            auto furthest = std::max(std::abs(channels[c] - low[c]), std::abs(channels[c] - high));
+                            minError += nearest * nearest;
+                            maxError += furthest * furthest;
+                        }
+                        minErrors[i] = minError;
+                        bound = std::min(bound, maxError);
+                    }
+
+                    _cellStart.push_back(static_cast<uint32_t>(_cellCandidates.size()));
+                    for (size_t i = 0; i < _changeableIndices.size(); i++)
+                    {
+                        if (minErrors[i] <= bound)
+                        {
+                            _cellCandidates.push_back(_changeableIndices[i]);
+                        }
+                    }
+                }
+            }
+        }
+        _cellStart.push_back(static_cast<uint32_t>(_cellCandidates.size()));
+    }
+
+    int32_t FindClosest(const int16_t* colour, const uint8_t* indices, size_t count) const
+    {
+        auto smallestError = std::numeric_limits<uint32_t>::max();
+        auto bestMatch = PALETTE_TRANSPARENT;
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto& entry = _palette[indices[i]];
+            auto dr = static_cast<int32_t>(entry.Red) - colour[0];
+            auto dg = static_cast<int32_t>(entry.Green) - colour[1];
+            auto db = static_cast<int32_t>(entry.Blue) - colour[2];
+            auto error = static_cast<uint32_t>(dr * dr + dg * dg + db * db);
+            if (error < smallestError)
+            {
+                bestMatch = indices[i];
+                smallestError = error;
+            }
+        }
+        return bestMatch;
+    }
+};
+
 ImportResult ImageImporter::Import(
     const Image& image, int32_t offsetX, int32_t offsetY, IMPORT_FLAGS flags, IMPORT_MODE mode) const
 {
@@ -216,17 +364,17 @@ int32_t ImageImporter::CalculatePaletteIndex(
     IMPORT_MODE mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
 {
     auto& palette = StandardPalette;
-    auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
+    auto paletteIndex = GetPaletteIndex(rgbaSrc);
     if (mode == IMPORT_MODE::CLOSEST || mode == IMPORT_MODE::DITHERING)
     {
         if (paletteIndex == PALETTE_TRANSPARENT && !IsTransparentPixel(rgbaSrc))
         {
-            paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+            paletteIndex = GetClosestPaletteIndex(rgbaSrc);
         }
     }
     if (mode == IMPORT_MODE::DITHERING)
     {
-        if (!IsTransparentPixel(rgbaSrc) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc)))
+        if (!IsTransparentPixel(rgbaSrc) && IsChangablePixel(GetPaletteIndex(rgbaSrc)))
         {
             auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].Red);
             auto dg = rgbaSrc[1] - static_cast<int16_t>(palette[paletteIndex].Green);
@@ -234,7 +382,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
 
             if (x + 1 < width)
             {
-                if (!IsTransparentPixel(rgbaSrc + 4) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4)))
+                if (!IsTransparentPixel(rgbaSrc + 4) && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4)))
                 {
                     // Right
                     rgbaSrc[4] += dr * 7 / 16;
@@ -248,7 +396,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 if (x > 0)
                 {
                     if (!IsTransparentPixel(rgbaSrc + 4 * (width - 1))
-                        && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                        && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4 * (width - 1))))
                     {
                         // Bottom left
                         rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -258,7 +406,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 }
 
                 // Bottom
-                if (!IsTransparentPixel(rgbaSrc + 4 * width) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * width)))
+                if (!IsTransparentPixel(rgbaSrc + 4 * width) && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4 * width)))
                 {
                     rgbaSrc[4 * width] += dr * 5 / 16;
                     rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -268,7 +416,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 if (x + 1 < width)
                 {
                     if (!IsTransparentPixel(rgbaSrc + 4 * (width + 1))
-                        && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                        && IsChangablePixel(GetPaletteIndex(rgbaSrc + 4 * (width + 1))))
                     {
                         // Bottom right
                         rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -282,18 +430,17 @@ int32_t ImageImporter::CalculatePaletteIndex(
     return paletteIndex;
 }
 
-int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
+const ImageImporter::PaletteLookup& ImageImporter::GetStandardPaletteLookup()
+{
+    static const PaletteLookup lookup(StandardPalette);
+    return lookup;
+}
+
+int32_t ImageImporter::GetPaletteIndex(const int16_t* colour)
 {
     if (!IsTransparentPixel(colour))
     {
-        for (int32_t i = 0; i < PALETTE_SIZE; i++)
-        {
-            if (static_cast<int16_t>(palette[i].Red) == colour[0] && static_cast<int16_t>(palette[i].Green) == colour[1]
-                && static_cast<int16_t>(palette[i].Blue) == colour[2])
-            {
-                return i;
-            }
-        }
+        return GetStandardPaletteLookup().FindExact(colour);
     }
     return PALETTE_TRANSPARENT;
 }
@@ -323,25 +470,7 @@ bool ImageImporter::IsChangablePixel(int32_t paletteIndex)
     return true;
 }
 
-int32_t ImageImporter::GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour)
+int32_t ImageImporter::GetClosestPaletteIndex(const int16_t* colour)
 {
-    auto smallestError = static_cast<uint32_t>(-1);
-    auto bestMatch = PALETTE_TRANSPARENT;
-    for (int32_t x = 0; x < PALETTE_SIZE; x++)
-    {
-        if (IsChangablePixel(x))
-        {
-            uint32_t error = (static_cast<int16_t>(palette[x].Red) - colour[0])
-                    * (static_cast<int16_t>(palette[x].Red) - colour[0])
-                + (static_cast<int16_t>(palette[x].Green) - colour[1]) * (static_cast<int16_t>(palette[x].Green) - colour[1])
-                + (static_cast<int16_t>(palette[x].Blue) - colour[2]) * (static_cast<int16_t>(palette[x].Blue) - colour[2]);
-
-            if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
-            {
-                bestMatch = x;
-                smallestError = error;
-            }
-        }
-    }
-    return bestMatch;
+    return GetStandardPaletteLookup().FindClosest(colour);
 }
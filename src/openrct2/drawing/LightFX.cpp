@@ -14,6 +14,7 @@
 #    include "../Game.h"
 #    include "../common.h"
 #    include "../config/Config.h"
+#    include "../core/JobPool.h"
 #    include "../interface/Viewport.h"
 #    include "../interface/Window.h"
 #    include "../interface/Window_internal.h"
@@ -29,6 +30,10 @@
 #    include <algorithm>
 #    include <cmath>
 #    include <cstring>
+#    include <memory>
+#    include <mutex>
+#    include <unordered_map>
+#    include <vector>
 
 static uint8_t _bakedLightTexture_lantern_0[32 * 32];
 static uint8_t _bakedLightTexture_lantern_1[64 * 64];
@@ -75,6 +80,30 @@ static lightlist_entry* _LightListFront;
 static uint32_t LightListCurrentCountBack;
 static uint32_t LightListCurrentCountFront;
 
+// Lights are added by paint sessions running on the paint job threads
+static std::mutex _LightListBackMutex;
+static std::unordered_map<uint64_t, uint32_t> _LightListBackIndex;
+
+struct LightSplat
+{
+    const uint8_t* Source;
+    uint32_t SourcePitch;
+    int32_t X;
+    int32_t Y;
+    int32_t Width;
+    int32_t Height;
+    uint32_t Scale;
+};
+
+static std::vector<LightSplat> _LightSplats;
+
+// Height of the bands of the light buffer each job renders all lights into
+static constexpr int32_t LightBandHeight = 64;
+// Number of lights each job tests for occlusion
+static constexpr uint32_t LightOcclusionBatchSize = 32;
+
+static std::unique_ptr<JobPool> _lightJobs;
+
 static int16_t _current_view_x_front = 0;
 static int16_t _current_view_y_front = 0;
 static uint8_t _current_view_rotation_front = 0;
@@ -191,220 +220,257 @@ void lightfx_update_buffers(rct_drawpixelinfo* info)
 
 extern void viewport_paint_setup();
 
-void lightfx_prepare_light_list()
+static JobPool* lightfx_get_job_pool()
 {
-    for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+    bool useMultithreading = gConfigGeneral.multithreading;
+    if (useMultithreading && _lightJobs == nullptr)
     {
-        lightlist_entry* entry = &_LightListFront[light];
+        _lightJobs = std::make_unique<JobPool>();
+    }
+    else if (useMultithreading == false && _lightJobs != nullptr)
+    {
+        _lightJobs.reset();
+    }
+    return _lightJobs.get();
+}
 
-        if (entry->z == 0x7FFF)
-        {
-            entry->lightIntensity = 0xFF;
-            continue;
-        }
+static void lightfx_prepare_light(lightlist_entry* entry)
+{
+    if (entry->z == 0x7FFF)
+    {
+        entry->lightIntensity = 0xFF;
+        return;
+    }
 
-        CoordsXYZ coord_3d = { /* .x = */ entry->x,
-                               /* .y = */ entry->y,
-                               /* .z = */ entry->z };
+    CoordsXYZ coord_3d = { /* .x = */ entry->x,
+                           /* .y = */ entry->y,
+                           /* .z = */ entry->z };
 
-        int32_t posOnScreenX = entry->viewCoords.x - _current_view_x_front;
-        int32_t posOnScreenY = entry->viewCoords.y - _current_view_y_front;
+    int32_t posOnScreenX = entry->viewCoords.x - _current_view_x_front;
+    int32_t posOnScreenY = entry->viewCoords.y - _current_view_y_front;
 
-        posOnScreenX = posOnScreenX / _current_view_zoom_front;
-        posOnScreenY = posOnScreenY / _current_view_zoom_front;
+    posOnScreenX = posOnScreenX / _current_view_zoom_front;
+    posOnScreenY = posOnScreenY / _current_view_zoom_front;
 
-        if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
-            || (posOnScreenY > _pixelInfo.height + 128))
-        {
-            entry->lightType = LightType::None;
-            continue;
-        }
+    if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
+        || (posOnScreenY > _pixelInfo.height + 128))
+    {
+        entry->lightType = LightType::None;
+        return;
+    }
 
-        uint32_t lightIntensityOccluded = 0x0;
+    uint32_t lightIntensityOccluded = 0x0;
 
-        int32_t dirVecX = 707;
-        int32_t dirVecY = 707;
+    int32_t dirVecX = 707;
+    int32_t dirVecY = 707;
 
-        switch (_current_view_rotation_front)
-        {
-            case 0:
-                dirVecX = 707;
-                dirVecY = 707;
-                break;
-            case 1:
-                dirVecX = -707;
-                dirVecY = 707;
-                break;
-            case 2:
-                dirVecX = -707;
-                dirVecY = -707;
-                break;
-            case 3:
-                dirVecX = 707;
-                dirVecY = -707;
-                break;
-            default:
-                dirVecX = 0;
-                dirVecY = 0;
-                break;
-        }
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            dirVecX = 707;
+            dirVecY = 707;
+            break;
+        case 1:
+            dirVecX = -707;
+            dirVecY = 707;
+            break;
+        case 2:
+            dirVecX = -707;
+            dirVecY = -707;
+            break;
+        case 3:
+            dirVecX = 707;
+            dirVecY = -707;
+            break;
+        default:
+            dirVecX = 0;
+            dirVecY = 0;
+            break;
+    }
 
-        int32_t tileOffsetX = 0;
-        int32_t tileOffsetY = 0;
-        switch (_current_view_rotation_front)
-        {
-            case 0:
-                tileOffsetX = 0;
-                tileOffsetY = 0;
-                break;
-            case 1:
-                tileOffsetX = 16;
-                tileOffsetY = 0;
-                break;
-            case 2:
-                tileOffsetX = 32;
-                tileOffsetY = 32;
-                break;
-            case 3:
-                tileOffsetX = 0;
-                tileOffsetY = 16;
-                break;
-        }
+    int32_t tileOffsetX = 0;
+    int32_t tileOffsetY = 0;
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            tileOffsetX = 0;
+            tileOffsetY = 0;
+            break;
+        case 1:
+            tileOffsetX = 16;
+            tileOffsetY = 0;
+            break;
+        case 2:
+            tileOffsetX = 32;
+            tileOffsetY = 32;
+            break;
+        case 3:
+            tileOffsetX = 0;
+            tileOffsetY = 16;
+            break;
+    }
 
-        int32_t mapFrontDiv = 1 * _current_view_zoom_front;
+    int32_t mapFrontDiv = 1 * _current_view_zoom_front;
 
-        // clang-format off
-        static int16_t offsetPattern[26] = {
-            0, 0,
-            -4, 0, 0, -3, 4, 0, 0, 3,
-            -2, -1, -1, -1, 2, 1, 1, 1,
-            -3, -2, -3, 2, 3, -2, 3, 2,
-        };
-        // clang-format on
+    // clang-format off
+    static constexpr const int16_t offsetPattern[26] = {
+        0, 0,
+        -4, 0, 0, -3, 4, 0, 0, 3,
+        -2, -1, -1, -1, 2, 1, 1, 1,
+        -3, -2, -3, 2, 3, -2, 3, 2,
+    };
+    // clang-format on
 
-        // Light occlusion code
-        if (true)
-        {
-            int32_t totalSamplePoints = 5;
-            int32_t startSamplePoint = 1;
+    // Light occlusion code
+    if (true)
+    {
+        int32_t totalSamplePoints = 5;
+        int32_t startSamplePoint = 1;
 
-            if (entry->qualifier == LightFXQualifier::Map)
-            {
-                startSamplePoint = 0;
-                totalSamplePoints = 1;
-            }
+        if (entry->qualifier == LightFXQualifier::Map)
+        {
+            startSamplePoint = 0;
+            totalSamplePoints = 1;
+        }
 
-            for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
-            {
-                CoordsXY mapCoord{};
+        for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
+        {
+            CoordsXY mapCoord{};
 
-                TileElement* tileElement = nullptr;
+            TileElement* tileElement = nullptr;
 
-                ViewportInteractionItem interactionType = ViewportInteractionItem::None;
+            ViewportInteractionItem interactionType = ViewportInteractionItem::None;
 
-                auto* w = window_get_main();
-                if (w != nullptr)
-                {
-                    // based on get_map_coordinates_from_pos_window
-                    rct_drawpixelinfo dpi;
-                    dpi.x = entry->viewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
-                    dpi.y = entry->viewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
-                    dpi.height = 1;
-                    dpi.zoom_level = _current_view_zoom_front;
-                    dpi.width = 1;
-
-                    paint_session* session = PaintSessionAlloc(&dpi, w->viewport->flags);
-                    PaintSessionGenerate(session);
-                    PaintSessionArrange(session);
-                    auto info = set_interaction_info_from_paint_session(session, ViewportInteractionItemAll);
-                    PaintSessionFree(session);
-
-                    //  log_warning("[%i, %i]", dpi->x, dpi->y);
-
-                    mapCoord = info.Loc;
-                    mapCoord.x += tileOffsetX;
-                    mapCoord.y += tileOffsetY;
-                    interactionType = info.SpriteType;
-                    tileElement = info.Element;
-                }
+            auto* w = window_get_main();
+            if (w != nullptr)
+            {
+                // based on get_map_coordinates_from_pos_window
+                rct_drawpixelinfo dpi;
+                dpi.x = entry->viewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
+                dpi.y = entry->viewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
+                dpi.height = 1;
+                dpi.zoom_level = _current_view_zoom_front;
+                dpi.width = 1;
+
+                paint_session* session = PaintSessionAlloc(&dpi, w->viewport->flags);
+                PaintSessionGenerate(session);
+                PaintSessionArrange(session);
+                auto info = set_interaction_info_from_paint_session(session, ViewportInteractionItemAll);
+                PaintSessionFree(session);
+
+                //  log_warning("[%i, %i]", dpi->x, dpi->y);
+
+                mapCoord = info.Loc;
+                mapCoord.x += tileOffsetX;
+                mapCoord.y += tileOffsetY;
+                interactionType = info.SpriteType;
+                tileElement = info.Element;
+            }
 
-                int32_t minDist = 0;
-                int32_t baseHeight = (-999) * COORDS_Z_STEP;
+            int32_t minDist = 0;
+            int32_t baseHeight = (-999) * COORDS_Z_STEP;
 
-                if (interactionType != ViewportInteractionItem::Entity && tileElement)
-                {
-                    baseHeight = tileElement->GetBaseZ();
-                }
+            if (interactionType != ViewportInteractionItem::Entity && tileElement)
+            {
+                baseHeight = tileElement->GetBaseZ();
+            }
 
-                minDist = (baseHeight - coord_3d.z) / 2;
+            minDist = (baseHeight - coord_3d.z) / 2;
 
-                int32_t deltaX = mapCoord.x - coord_3d.x;
-                int32_t deltaY = mapCoord.y - coord_3d.y;
+            int32_t deltaX = mapCoord.x - coord_3d.x;
+            int32_t deltaY = mapCoord.y - coord_3d.y;
 
-                int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
+            int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
 
-                projDot = std::max(minDist, projDot);
+            projDot = std::max(minDist, projDot);
 
-                if (projDot < 5)
-                {
-                    lightIntensityOccluded += 100;
-                }
-                else
-                {
-                    lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
-                }
+            if (projDot < 5)
+            {
+                lightIntensityOccluded += 100;
+            }
+            else
+            {
+                lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
+            }
 
-                //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
-                //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
+            //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
+            //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
 
-                if (pat == 0)
-                {
-                    if (lightIntensityOccluded == 100)
-                        break;
-                    if (_current_view_zoom_front > 2)
-                        break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 4)
-                {
-                    if (_current_view_zoom_front > 1)
-                        break;
-                    if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
-                        break;
-                    // lastSampleCount = lightIntensityOccluded / 500;
-                    //  break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 8)
-                {
+            if (pat == 0)
+            {
+                if (lightIntensityOccluded == 100)
                     break;
-                }
+                if (_current_view_zoom_front > 2)
+                    break;
+                totalSamplePoints += 4;
             }
-
-            totalSamplePoints -= startSamplePoint;
-
-            if (lightIntensityOccluded == 0)
+            else if (pat == 4)
             {
-                entry->lightType = LightType::None;
-                continue;
+                if (_current_view_zoom_front > 1)
+                    break;
+                if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
+                    break;
+                // lastSampleCount = lightIntensityOccluded / 500;
+                //  break;
+                totalSamplePoints += 4;
+            }
+            else if (pat == 8)
+            {
+                break;
             }
+        }
+
+        totalSamplePoints -= startSamplePoint;
 
-            entry->lightIntensity = std::min<uint32_t>(
-                0xFF, (entry->lightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+        if (lightIntensityOccluded == 0)
+        {
+            entry->lightType = LightType::None;
+            return;
         }
-        entry->lightIntensity = std::max<uint32_t>(
-            0x00, entry->lightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
 
-        if (_current_view_zoom_front > 0)
+        entry->lightIntensity = std::min<uint32_t>(
+            0xFF, (entry->lightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+    }
+    entry->lightIntensity = std::max<uint32_t>(
+        0x00, entry->lightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
+
+    if (_current_view_zoom_front > 0)
+    {
+        if (GetLightTypeSize(entry->lightType) < static_cast<int8_t>(_current_view_zoom_front))
         {
-            if (GetLightTypeSize(entry->lightType) < static_cast<int8_t>(_current_view_zoom_front))
-            {
-                entry->lightType = LightType::None;
-                continue;
-            }
+            entry->lightType = LightType::None;
+            return;
+        }
 
-            entry->lightType = SetLightTypeSize(
-                entry->lightType, GetLightTypeSize(entry->lightType) - static_cast<int8_t>(_current_view_zoom_front));
+        entry->lightType = SetLightTypeSize(
+            entry->lightType, GetLightTypeSize(entry->lightType) - static_cast<int8_t>(_current_view_zoom_front));
+    }
+}
+
+void lightfx_prepare_light_list()
+{
+    // Each light reads the map and writes only its own entry. The paint sessions used for the occlusion tests come
+    // from the painter, which hands them out under a lock, so the tests can run in parallel.
+    auto* jobs = lightfx_get_job_pool();
+    if (jobs != nullptr)
+    {
+        for (uint32_t first = 0; first < LightListCurrentCountFront; first += LightOcclusionBatchSize)
+        {
+            uint32_t last = std::min(first + LightOcclusionBatchSize, LightListCurrentCountFront);
+            jobs->AddTask([first, last]() -> void {
+                for (uint32_t light = first; light < last; light++)
+                {
+                    lightfx_prepare_light(&_LightListFront[light]);
+                }
+            });
+        }
+        jobs->Join();
+    }
+    else
+    {
+        for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+        {
+            lightfx_prepare_light(&_LightListFront[light]);
         }
     }
 }
@@ -425,6 +491,7 @@ void lightfx_swap_buffers()
 
     LightListCurrentCountFront = LightListCurrentCountBack;
     LightListCurrentCountBack = 0x0;
+    _LightListBackIndex.clear();
 
     uint32_t uTmp = _lightPolution_back;
     _lightPolution_back = _lightPolution_front;
@@ -450,6 +517,24 @@ void lightfx_update_viewport_settings()
     }
 }
 
+static void lightfx_render_lights_to_band(int32_t top, int32_t bottom)
+{
+    uint8_t* buffer = static_cast<uint8_t*>(_light_rendered_buffer_front);
+    std::memset(buffer + top * _pixelInfo.width, 0, (bottom - top) * _pixelInfo.width);
+
+    for (const auto& splat : _LightSplats)
+    {
+        int32_t splatTop = std::max(top, splat.Y);
+        int32_t splatBottom = std::min(bottom, splat.Y + splat.Height);
+        for (int32_t y = splatTop; y < splatBottom; y++)
+        {
+            uint8_t* dst = buffer + y * _pixelInfo.width + splat.X;
+            const uint8_t* src = splat.Source + (y - splat.Y) * splat.SourcePitch;
+            light_add_fn(dst, src, splat.Width, splat.Scale);
+        }
+    }
+}
+
 void lightfx_render_lights_to_frontbuffer()
 {
     if (_light_rendered_buffer_front == nullptr)
@@ -457,20 +542,17 @@ void lightfx_render_lights_to_frontbuffer()
         return;
     }
 
-    std::memset(_light_rendered_buffer_front, 0, _pixelInfo.width * _pixelInfo.height);
-
     _lightPolution_back = 0;
+    _LightSplats.clear();
 
     //  log_warning("%i lights", LightListCurrentCountFront);
 
     for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
     {
         const uint8_t* bufReadBase = nullptr;
-        uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front);
         uint32_t bufReadWidth, bufReadHeight;
         int32_t bufWriteX, bufWriteY;
         int32_t bufWriteWidth, bufWriteHeight;
-        uint32_t bufReadSkip, bufWriteSkip;
 
         lightlist_entry* entry = &_LightListFront[light];
 
@@ -542,10 +624,6 @@ void lightfx_render_lights_to_frontbuffer()
             bufReadBase += -bufWriteX;
             bufWriteWidth += bufWriteX;
         }
-        else
-        {
-            bufWriteBase += bufWriteX;
-        }
 
         if (bufWriteWidth <= 0)
             continue;
@@ -555,10 +633,6 @@ void lightfx_render_lights_to_frontbuffer()
             bufReadBase += -bufWriteY * bufReadWidth;
             bufWriteHeight += bufWriteY;
         }
-        else
-        {
-            bufWriteBase += bufWriteY * _pixelInfo.width;
-        }
 
         if (bufWriteHeight <= 0)
             continue;
@@ -582,39 +656,24 @@ void lightfx_render_lights_to_frontbuffer()
 
         _lightPolution_back += (bufWriteWidth * bufWriteHeight) / 256;
 
-        bufReadSkip = bufReadWidth - bufWriteWidth;
-        bufWriteSkip = _pixelInfo.width - bufWriteWidth;
-
-        if (entry->lightIntensity == 0xFF)
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
+        _LightSplats.push_back({ bufReadBase, bufReadWidth, std::max(0, bufWriteX), std::max(0, bufWriteY), bufWriteWidth,
+                                 bufWriteHeight, 1u + entry->lightIntensity });
+    }
 
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
-        else
+    // Every job owns a band of rows and blends all lights into it, so no two jobs write the same pixels
+    auto* jobs = lightfx_get_job_pool();
+    if (jobs != nullptr)
+    {
+        for (int32_t top = 0; top < _pixelInfo.height; top += LightBandHeight)
         {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->lightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
+            int32_t bottom = std::min<int32_t>(top + LightBandHeight, _pixelInfo.height);
+            jobs->AddTask([top, bottom]() -> void { lightfx_render_lights_to_band(top, bottom); });
         }
+        jobs->Join();
+    }
+    else
+    {
+        lightfx_render_lights_to_band(0, _pixelInfo.height);
     }
 }
 
@@ -632,39 +691,30 @@ static void LightfxAdd3DLight(
     const uint32_t lightHash, const LightFXQualifier qualifier, const uint8_t id, const CoordsXYZ& loc,
     const LightType lightType)
 {
-    if (LightListCurrentCountBack == 15999)
-    {
-        return;
-    }
+    std::lock_guard<std::mutex> lock(_LightListBackMutex);
 
     //  log_warning("%i lights in back", LightListCurrentCountBack);
 
-    for (uint32_t i = 0; i < LightListCurrentCountBack; i++)
+    const uint64_t key = (static_cast<uint64_t>(lightHash) << 16) | (static_cast<uint64_t>(qualifier) << 8) | id;
+    lightlist_entry* entry = nullptr;
+    auto it = _LightListBackIndex.find(key);
+    if (it != _LightListBackIndex.end())
     {
-        lightlist_entry* entry = &_LightListBack[i];
-        if (entry->lightHash != lightHash)
-            continue;
-        if (entry->qualifier != qualifier)
-            continue;
-        if (entry->lightID != id)
-            continue;
+        entry = &_LightListBack[it->second];
+    }
+    else
+    {
+        if (LightListCurrentCountBack == 15999)
+        {
+            return;
+        }
 
-        entry->x = loc.x;
-        entry->y = loc.y;
-        entry->z = loc.z;
-        entry->viewCoords = translate_3d_to_2d_with_z(get_current_rotation(), loc);
-        entry->lightType = lightType;
-        entry->lightIntensity = 0xFF;
-        entry->lightHash = lightHash;
-        entry->qualifier = qualifier;
-        entry->lightID = id;
-        entry->lightLinger = 1;
+        //  log_warning("new 3d light");
 
-        return;
+        _LightListBackIndex.emplace(key, LightListCurrentCountBack);
+        entry = &_LightListBack[LightListCurrentCountBack++];
     }
 
-    lightlist_entry* entry = &_LightListBack[LightListCurrentCountBack++];
-
     entry->x = loc.x;
     entry->y = loc.y;
     entry->z = loc.z;
@@ -675,8 +725,6 @@ static void LightfxAdd3DLight(
     entry->qualifier = qualifier;
     entry->lightID = id;
     entry->lightLinger = 1;
-
-    //  log_warning("new 3d light");
 }
 
 static void LightfxAdd3DLight(const CoordsXYZ& loc, const LightType lightType)
@@ -1021,15 +1069,6 @@ void lightfx_apply_palette_filter(uint8_t i, uint8_t* r, uint8_t* g, uint8_t* b)
     }
 }
 
-static uint8_t mix_light(uint32_t a, uint32_t b, uint32_t intensity)
-{
-    intensity = intensity * 6;
-    uint32_t bMul = (b * intensity) >> 8;
-    uint32_t ab = a + bMul;
-    uint8_t result = std::min<uint32_t>(255, ab);
-    return result;
-}
-
 void lightfx_render_to_texture(
     void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
     const uint32_t* lightPalette)
@@ -1049,27 +1088,7 @@ void lightfx_render_to_texture(
     {
         uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
         uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
-        for (uint32_t x = 0; x < width; x++)
-        {
-            uint8_t* src = &bits[y * width + x];
-            uint32_t darkColour = palette[*src];
-            uint32_t lightColour = lightPalette[*src];
-            uint8_t lightIntensity = lightBits[y * width + x];
-
-            uint32_t colour = 0;
-            if (lightIntensity == 0)
-            {
-                colour = darkColour;
-            }
-            else
-            {
-                colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
-            }
-            *dst++ = colour;
-        }
+        palette_expand_light_fn(&bits[y * width], &lightBits[y * width], dst, width, palette, lightPalette);
     }
 }
 
@@ -13,6 +13,7 @@
 
 #ifdef __SSE4_1__
 
+#    include <cstring>
 #    include <immintrin.h>
 
 void mask_sse4_1(
@@ -56,6 +57,56 @@ void mask_sse4_1(
     }
 }
 
+void palette_expand_light_sse4_1(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette)
+{
+    // Spreads the intensity of each of the four pixels over its four channels
+    const __m128i intensityShuffle = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+    const __m128i intensityScale = _mm_set1_epi16(6);
+
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i dark = _mm_setr_epi32(
+            palette[src[i + 0]], palette[src[i + 1]], palette[src[i + 2]], palette[src[i + 3]]);
+        const __m128i light = _mm_setr_epi32(
+            lightPalette[src[i + 0]], lightPalette[src[i + 1]], lightPalette[src[i + 2]], lightPalette[src[i + 3]]);
+
+        int32_t intensities;
+        std::memcpy(&intensities, lightSrc + i, sizeof(intensities));
+        const __m128i intensity8 = _mm_shuffle_epi8(_mm_cvtsi32_si128(intensities), intensityShuffle);
+        const __m128i intensityLo = _mm_mullo_epi16(_mm_cvtepu8_epi16(intensity8), intensityScale);
+        const __m128i intensityHi = _mm_mullo_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(intensity8, 8)), intensityScale);
+
+        // (light * intensity) >> 8 is the high half of (light << 8) * intensity
+        const __m128i lightLo = _mm_slli_epi16(_mm_cvtepu8_epi16(light), 8);
+        const __m128i lightHi = _mm_slli_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(light, 8)), 8);
+        const __m128i mixLo = _mm_add_epi16(_mm_cvtepu8_epi16(dark), _mm_mulhi_epu16(lightLo, intensityLo));
+        const __m128i mixHi = _mm_add_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(dark, 8)), _mm_mulhi_epu16(lightHi, intensityHi));
+
+        // Saturates each channel to 255
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(mixLo, mixHi));
+    }
+    palette_expand_light_scalar(src + i, lightSrc + i, dst + i, count - i, palette, lightPalette);
+}
+
+void light_add_sse4_1(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale)
+{
+    const __m128i scale16 = _mm_set1_epi16(static_cast<int16_t>(scale));
+
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i light = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i lightLo = _mm_srli_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(light), scale16), 8);
+        const __m128i lightHi = _mm_srli_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(light, 8)), scale16), 8);
+        const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epu8(current, _mm_packus_epi16(lightLo, lightHi)));
+    }
+    light_add_scalar(dst + i, src + i, count - i, scale);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +120,16 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void palette_expand_light_sse4_1(
+    const uint8_t* RESTRICT src, const uint8_t* RESTRICT lightSrc, uint32_t* RESTRICT dst, int32_t count,
+    const uint32_t* RESTRICT palette, const uint32_t* RESTRICT lightPalette)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void light_add_sse4_1(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, int32_t count, uint32_t scale)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
@@ -10,7 +10,10 @@
 #ifndef NO_TTF
 
 #    include <atomic>
+#    include <list>
 #    include <mutex>
+#    include <string>
+#    include <unordered_map>
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
 #    include <ft2build.h>
@@ -27,42 +30,112 @@
 
 static bool _ttfInitialised = false;
 
-#    define TTF_SURFACE_CACHE_SIZE 256
-#    define TTF_GETWIDTH_CACHE_SIZE 1024
+constexpr size_t TTF_SURFACE_CACHE_SIZE = 2048;
+constexpr size_t TTF_GETWIDTH_CACHE_SIZE = 4096;
 
-struct ttf_cache_entry
+/**
+ * Least recently used cache of values for rendered runs of text, keyed by font and text. Unlike the previous fixed
+ * hash tables, a miss only ever evicts the entry that was used longest ago.
+ */
+template<typename T> class TTFRunCache
 {
-    TTFSurface* surface;
-    TTF_Font* font;
-    utf8* text;
-    uint32_t lastUseTick;
-};
+private:
+    struct Key
+    {
+        const TTF_Font* Font;
+        std::string_view Text;
 
-struct ttf_getwidth_cache_entry
-{
-    uint32_t width;
-    TTF_Font* font;
-    utf8* text;
-    uint32_t lastUseTick;
+        bool operator==(const Key& other) const
+        {
+            return Font == other.Font && Text == other.Text;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            return std::hash<std::string_view>()(key.Text) ^ (reinterpret_cast<uintptr_t>(key.Font) * 23);
+        }
+    };
+
+    struct Entry
+    {
+        const TTF_Font* Font;
+        std::string Text;
+        T Value;
+    };
+
+    const size_t _capacity;
+    std::list<Entry> _entries;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> _index;
+    void (*const _dispose)(T&);
+
+public:
+    uint32_t Hits = 0;
+    uint32_t Misses = 0;
+
+    TTFRunCache(size_t capacity, void (*dispose)(T&))
+        : _capacity(capacity)
+        , _dispose(dispose)
+    {
+    }
+
+    size_t GetCount() const
+    {
+        return _entries.size();
+    }
+
+    T* Get(const TTF_Font* font, std::string_view text)
+    {
+        auto it = _index.find({ font, text });
+        if (it == _index.end())
+        {
+            Misses++;
+            return nullptr;
+        }
+
+        Hits++;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return &it->second->Value;
+    }
+
+    T& Add(const TTF_Font* font, std::string_view text, T value)
+    {
+        if (_entries.size() >= _capacity)
+        {
+            auto& oldest = _entries.back();
+            _index.erase({ oldest.Font, oldest.Text });
+            _dispose(oldest.Value);
+            _entries.pop_back();
+        }
+
+        _entries.push_front({ font, std::string(text), value });
+        auto& entry = _entries.front();
+        _index.emplace(Key{ entry.Font, entry.Text }, _entries.begin());
+        return entry.Value;
+    }
+
+    void Clear()
+    {
+        for (auto& entry : _entries)
+        {
+            _dispose(entry.Value);
+        }
+        _index.clear();
+        _entries.clear();
+    }
 };
 
-static ttf_cache_entry _ttfSurfaceCache[TTF_SURFACE_CACHE_SIZE] = {};
-static int32_t _ttfSurfaceCacheCount = 0;
-static int32_t _ttfSurfaceCacheHitCount = 0;
-static int32_t _ttfSurfaceCacheMissCount = 0;
+static void ttf_surface_cache_dispose(TTFSurface*& surface);
 
-static ttf_getwidth_cache_entry _ttfGetWidthCache[TTF_GETWIDTH_CACHE_SIZE] = {};
-static int32_t _ttfGetWidthCacheCount = 0;
-static int32_t _ttfGetWidthCacheHitCount = 0;
-static int32_t _ttfGetWidthCacheMissCount = 0;
+static TTFRunCache<TTFSurface*> _ttfSurfaceCache(TTF_SURFACE_CACHE_SIZE, ttf_surface_cache_dispose);
+static TTFRunCache<uint32_t> _ttfGetWidthCache(TTF_GETWIDTH_CACHE_SIZE, [](uint32_t&) {});
 
 static std::mutex _mutex;
 
 static TTF_Font* ttf_open_font(const utf8* fontPath, int32_t ptSize);
 static void ttf_close_font(TTF_Font* font);
-static void ttf_surface_cache_dispose(ttf_cache_entry* entry);
-static void ttf_surface_cache_dispose_all();
-static void ttf_getwidth_cache_dispose_all();
 static bool ttf_get_size(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight);
 static void ttf_toggle_hinting(bool);
 static TTFSurface* ttf_render(TTF_Font* font, std::string_view text);
@@ -101,10 +174,7 @@ static void ttf_toggle_hinting(bool)
         TTF_SetFontHinting(fontDesc->font, use_hinting ? 1 : 0);
     }
 
-    if (_ttfSurfaceCacheCount)
-    {
-        ttf_surface_cache_dispose_all();
-    }
+    _ttfSurfaceCache.Clear();
 }
 
 bool ttf_initialise()
@@ -153,8 +223,8 @@ void ttf_dispose()
     if (!_ttfInitialised)
         return;
 
-    ttf_surface_cache_dispose_all();
-    ttf_getwidth_cache_dispose_all();
+    _ttfSurfaceCache.Clear();
+    _ttfGetWidthCache.Clear();
 
     for (int32_t i = 0; i < FONT_SIZE_COUNT; i++)
     {
@@ -181,36 +251,10 @@ static void ttf_close_font(TTF_Font* font)
     TTF_CloseFont(font);
 }
 
-static uint32_t ttf_surface_cache_hash(TTF_Font* font, std::string_view text)
-{
-    uint32_t hash = static_cast<uint32_t>(((reinterpret_cast<uintptr_t>(font) * 23) ^ 0xAAAAAAAA) & 0xFFFFFFFF);
-    for (auto c : text)
-    {
-        hash = ror32(hash, 3) ^ (c * 13);
-    }
-    return hash;
-}
-
-static void ttf_surface_cache_dispose(ttf_cache_entry* entry)
+static void ttf_surface_cache_dispose(TTFSurface*& surface)
 {
-    if (entry->surface != nullptr)
-    {
-        ttf_free_surface(entry->surface);
-        free(entry->text);
-
-        entry->surface = nullptr;
-        entry->font = nullptr;
-        entry->text = nullptr;
-    }
-}
-
-static void ttf_surface_cache_dispose_all()
-{
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
-    {
-        ttf_surface_cache_dispose(&_ttfSurfaceCache[i]);
-        _ttfSurfaceCacheCount--;
-    }
+    ttf_free_surface(surface);
+    surface = nullptr;
 }
 
 void ttf_toggle_hinting()
@@ -221,129 +265,49 @@ void ttf_toggle_hinting()
 
 TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, std::string_view text)
 {
-    ttf_cache_entry* entry;
-
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_SURFACE_CACHE_SIZE;
-
     FontLockHelper<std::mutex> lock(_mutex);
 
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
+    auto cached = _ttfSurfaceCache.Get(font, text);
+    if (cached != nullptr)
     {
-        entry = &_ttfSurfaceCache[index];
-
-        // Check if entry is a hit
-        if (entry->surface == nullptr)
-            break;
-        if (entry->font == font && String::Equals(entry->text, text))
-        {
-            _ttfSurfaceCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->surface;
-        }
-
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
-        {
-            break;
-        }
-
-        // Check if next entry is a hit
-        if (++index >= TTF_SURFACE_CACHE_SIZE)
-            index = 0;
+        return *cached;
     }
 
-    // Cache miss, replace entry with new surface
-    entry = &_ttfSurfaceCache[index];
-    ttf_surface_cache_dispose(entry);
-
     TTFSurface* surface = ttf_render(font, text);
     if (surface == nullptr)
     {
         return nullptr;
     }
-
-    _ttfSurfaceCacheMissCount++;
-    // printf("CACHE HITS: %d   MISSES: %d)\n", _ttfSurfaceCacheHitCount, _ttfSurfaceCacheMissCount);
-
-    _ttfSurfaceCacheCount++;
-    entry->surface = surface;
-    entry->font = font;
-    entry->text = strndup(text.data(), text.size());
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->surface;
-}
-
-static void ttf_getwidth_cache_dispose(ttf_getwidth_cache_entry* entry)
-{
-    if (entry->text != nullptr)
-    {
-        free(entry->text);
-
-        entry->width = 0;
-        entry->font = nullptr;
-        entry->text = nullptr;
-    }
-}
-
-static void ttf_getwidth_cache_dispose_all()
-{
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
-    {
-        ttf_getwidth_cache_dispose(&_ttfGetWidthCache[i]);
-        _ttfGetWidthCacheCount--;
-    }
+    return _ttfSurfaceCache.Add(font, text, surface);
 }
 
 uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, std::string_view text)
 {
-    ttf_getwidth_cache_entry* entry;
-
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_GETWIDTH_CACHE_SIZE;
-
     FontLockHelper<std::mutex> lock(_mutex);
 
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    auto cached = _ttfGetWidthCache.Get(font, text);
+    if (cached != nullptr)
     {
-        entry = &_ttfGetWidthCache[index];
-
-        // Check if entry is a hit
-        if (entry->text == nullptr)
-            break;
-        if (entry->font == font && String::Equals(entry->text, text))
-        {
-            _ttfGetWidthCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
-            return entry->width;
-        }
-
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
-        {
-            break;
-        }
-
-        // Check if next entry is a hit
-        if (++index >= TTF_GETWIDTH_CACHE_SIZE)
-            index = 0;
+        return *cached;
     }
 
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
-    ttf_getwidth_cache_dispose(entry);
-
     int32_t width, height;
     ttf_get_size(font, text, &width, &height);
+    return _ttfGetWidthCache.Add(font, text, width);
+}
 
-    _ttfGetWidthCacheMissCount++;
+TTFCacheStats ttf_get_cache_stats()
+{
+    FontLockHelper<std::mutex> lock(_mutex);
 
-    _ttfGetWidthCacheCount++;
-    entry->width = width;
-    entry->font = font;
-    entry->text = strndup(text.data(), text.size());
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->width;
+    TTFCacheStats stats;
+    stats.SurfaceCount = static_cast<uint32_t>(_ttfSurfaceCache.GetCount());
+    stats.SurfaceHits = _ttfSurfaceCache.Hits;
+    stats.SurfaceMisses = _ttfSurfaceCache.Misses;
+    stats.WidthCount = static_cast<uint32_t>(_ttfGetWidthCache.GetCount());
+    stats.WidthHits = _ttfGetWidthCache.Hits;
+    stats.WidthMisses = _ttfGetWidthCache.Misses;
+    return stats;
 }
 
 TTFFontDescriptor* ttf_get_font_from_sprite_base(FontSpriteBase spriteBase)
@@ -41,6 +41,7 @@ misrepresented as being the original software.
 #    include <stdio.h>
 #    include <stdlib.h>
 #    include <string.h>
+#    include <unordered_map>
 
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
@@ -134,6 +135,9 @@ struct _TTF_Font
     c_glyph* current;
     c_glyph cache[257]; /* 257 is a prime */
 
+    /* Glyphs whose slot in cache is taken by another character, so they are not re-rendered on every collision */
+    std::unordered_map<uint16_t, c_glyph>* overflow;
+
     /* We are responsible for closing the font stream */
     FILE* src;
     int freesrc;
@@ -575,6 +579,15 @@ static void Flush_Cache(TTF_Font* font)
             Flush_Glyph(&font->cache[i]);
         }
     }
+
+    if (font->overflow != nullptr)
+    {
+        for (auto& entry : *font->overflow)
+        {
+            Flush_Glyph(&entry.second);
+        }
+        font->overflow->clear();
+    }
 }
 
 static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int want)
@@ -975,8 +988,14 @@ static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
     int h = ch % hsize;
     font->current = &font->cache[h];
 
-    if (font->current->cached != ch)
-        Flush_Glyph(font->current);
+    if (font->current->cached != ch && font->current->cached != 0)
+    {
+        if (font->overflow == nullptr)
+        {
+            font->overflow = new std::unordered_map<uint16_t, c_glyph>();
+        }
+        font->current = &(*font->overflow)[ch];
+    }
 
     if ((font->current->stored & want) != want)
     {
@@ -990,6 +1009,7 @@ void TTF_CloseFont(TTF_Font* font)
     if (font)
     {
         Flush_Cache(font);
+        delete font->overflow;
         if (font->face)
         {
             FT_Done_Face(font->face);
@@ -123,7 +123,6 @@ void X8WeatherDrawer::Restore()
 
 X8DrawingEngine::X8DrawingEngine([[maybe_unused]] const std::shared_ptr<Ui::IUiContext>& uiContext)
 {
-    _drawingContext = new X8DrawingContext(this);
     _bitsDPI.DrawingEngine = this;
 #ifdef __ENABLE_LIGHTFX__
     lightfx_set_available(true);
@@ -133,7 +132,6 @@ X8DrawingEngine::X8DrawingEngine([[maybe_unused]] const std::shared_ptr<Ui::IUiC
 
 X8DrawingEngine::~X8DrawingEngine()
 {
-    delete _drawingContext;
     delete[] _dirtyGrid.Blocks;
     delete[] _bits;
 }
@@ -209,6 +207,11 @@ void X8DrawingEngine::EndDraw()
 {
 }
 
+void X8DrawingEngine::EndDrawPipelined()
+{
+    EndDraw();
+}
+
 void X8DrawingEngine::PaintWindows()
 {
     window_reset_visibilities();
@@ -272,8 +275,10 @@ std::string X8DrawingEngine::Screenshot()
 
 IDrawingContext* X8DrawingEngine::GetDrawingContext(rct_drawpixelinfo* dpi)
 {
-    _drawingContext->SetDPI(dpi);
-    return _drawingContext;
+    // Viewport columns are drawn on the paint job threads, so each thread needs its own context
+    thread_local X8DrawingContext drawingContext(nullptr);
+    drawingContext = X8DrawingContext(this, dpi);
+    return &drawingContext;
 }
 
 rct_drawpixelinfo* X8DrawingEngine::GetDrawingPixelInfo()
@@ -283,7 +288,7 @@ rct_drawpixelinfo* X8DrawingEngine::GetDrawingPixelInfo()
 
 DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
 {
-    return DEF_DIRTY_OPTIMISATIONS;
+    return static_cast<DRAWING_ENGINE_FLAGS>(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
 }
 
 void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
@@ -362,8 +367,18 @@ void X8DrawingEngine::OnDrawDirtyBlock(
 
 void X8DrawingEngine::ConfigureDirtyGrid()
 {
+    // Grow the blocks with the resolution so that the grid stays roughly the same size, a full screen
+    // invalidation at 4K would otherwise be split into over a thousand blocks to scan and merge.
     _dirtyGrid.BlockShiftX = 7;
     _dirtyGrid.BlockShiftY = 6;
+    while ((_width >> _dirtyGrid.BlockShiftX) > MaxDirtyBlockColumns && _dirtyGrid.BlockShiftX < MaxDirtyBlockShift)
+    {
+        _dirtyGrid.BlockShiftX++;
+    }
+    while ((_height >> _dirtyGrid.BlockShiftY) > MaxDirtyBlockRows && _dirtyGrid.BlockShiftY < MaxDirtyBlockShift)
+    {
+        _dirtyGrid.BlockShiftY++;
+    }
     _dirtyGrid.BlockWidth = 1 << _dirtyGrid.BlockShiftX;
     _dirtyGrid.BlockHeight = 1 << _dirtyGrid.BlockShiftY;
     _dirtyGrid.BlockColumns = (_width >> _dirtyGrid.BlockShiftX) + 1;
@@ -371,16 +386,35 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
     delete[] _dirtyGrid.Blocks;
     _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows];
+
+    // The block layout may have changed, so redraw everything
+    std::fill_n(_dirtyGrid.Blocks, _dirtyGrid.BlockColumns * _dirtyGrid.BlockRows, 0xFF);
 }
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
+    CollectDirtyRegions();
+    for (const auto& region : _dirtyRegions)
+    {
+        DrawDirtyRegion(region);
+    }
+}
+
+/**
+ * Merges the dirty blocks into non-overlapping rectangular regions and clears them from the grid.
+ */
+void X8DrawingEngine::CollectDirtyRegions()
+{
+    _dirtyRegions.clear();
+
+    uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
+    uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
     for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
     {
         for (uint32_t y = 0; y < _dirtyGrid.BlockRows; y++)
         {
-            uint32_t yOffset = y * _dirtyGrid.BlockColumns;
-            if (_dirtyGrid.Blocks[yOffset + x] == 0)
+            uint32_t yOffset = y * dirtyBlockColumns;
+            if (screenDirtyBlocks[yOffset + x] == 0)
             {
                 continue;
             }
@@ -389,7 +423,7 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
             uint32_t xx;
             for (xx = x; xx < _dirtyGrid.BlockColumns; xx++)
             {
-                if (_dirtyGrid.Blocks[yOffset + xx] == 0)
+                if (screenDirtyBlocks[yOffset + xx] == 0)
                 {
                     break;
                 }
@@ -398,7 +432,15 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
             // Check rows
             uint32_t columns = xx - x;
             auto rows = GetNumDirtyRows(x, y, columns);
-            DrawDirtyBlocks(x, y, columns, rows);
+
+            // Unset dirty blocks
+            for (uint32_t top = y; top < y + rows; top++)
+            {
+                uint32_t topOffset = top * dirtyBlockColumns;
+                std::fill_n(screenDirtyBlocks + topOffset + x, columns, 0);
+            }
+
+            _dirtyRegions.push_back({ x, y, columns, rows });
         }
     }
 }
@@ -421,33 +463,20 @@ uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, co
     return yy - y;
 }
 
-void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
+void X8DrawingEngine::DrawDirtyRegion(const DirtyRegion& region)
 {
-    uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
-    uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
-
-    // Unset dirty blocks
-    for (uint32_t top = y; top < y + rows; top++)
-    {
-        uint32_t topOffset = top * dirtyBlockColumns;
-        for (uint32_t left = x; left < x + columns; left++)
-        {
-            screenDirtyBlocks[topOffset + left] = 0;
-        }
-    }
-
     // Determine region in pixels
-    uint32_t left = std::max<uint32_t>(0, x * _dirtyGrid.BlockWidth);
-    uint32_t top = std::max<uint32_t>(0, y * _dirtyGrid.BlockHeight);
-    uint32_t right = std::min(_width, left + (columns * _dirtyGrid.BlockWidth));
-    uint32_t bottom = std::min(_height, top + (rows * _dirtyGrid.BlockHeight));
+    uint32_t left = region.X * _dirtyGrid.BlockWidth;
+    uint32_t top = region.Y * _dirtyGrid.BlockHeight;
+    uint32_t right = std::min(_width, left + (region.Columns * _dirtyGrid.BlockWidth));
+    uint32_t bottom = std::min(_height, top + (region.Rows * _dirtyGrid.BlockHeight));
     if (right <= left || bottom <= top)
     {
         return;
     }
 
     // Draw region
-    OnDrawDirtyBlock(x, y, columns, rows);
+    OnDrawDirtyBlock(region.X, region.Y, region.Columns, region.Rows);
     window_draw_all(&_bitsDPI, left, top, right, bottom);
 }
 
@@ -460,6 +489,12 @@ X8DrawingContext::X8DrawingContext(X8DrawingEngine* engine)
     _engine = engine;
 }
 
+X8DrawingContext::X8DrawingContext(X8DrawingEngine* engine, rct_drawpixelinfo* dpi)
+{
+    _engine = engine;
+    _dpi = dpi;
+}
+
 IDrawingEngine* X8DrawingContext::GetEngine()
 {
     return _engine;
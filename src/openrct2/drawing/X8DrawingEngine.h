@@ -13,6 +13,8 @@
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 
+#include <vector>
+
 namespace OpenRCT2
 {
     namespace Ui
@@ -35,6 +37,14 @@ namespace OpenRCT2
             uint8_t* Blocks;
         };
 
+        struct DirtyRegion
+        {
+            uint32_t X;
+            uint32_t Y;
+            uint32_t Columns;
+            uint32_t Rows;
+        };
+
         class X8WeatherDrawer final : public IWeatherDrawer
         {
         private:
@@ -68,6 +78,10 @@ namespace OpenRCT2
         class X8DrawingEngine : public IDrawingEngine
         {
         protected:
+            static constexpr uint32_t MaxDirtyBlockColumns = 16;
+            static constexpr uint32_t MaxDirtyBlockRows = 16;
+            static constexpr uint32_t MaxDirtyBlockShift = 9;
+
             uint32_t _width = 0;
             uint32_t _height = 0;
             uint32_t _pitch = 0;
@@ -75,6 +89,7 @@ namespace OpenRCT2
             uint8_t* _bits = nullptr;
 
             DirtyGrid _dirtyGrid = {};
+            std::vector<DirtyRegion> _dirtyRegions;
 
             rct_drawpixelinfo _bitsDPI = {};
 
@@ -83,7 +98,6 @@ namespace OpenRCT2
 #endif
 
             X8WeatherDrawer _weatherDrawer;
-            X8DrawingContext* _drawingContext;
 
         public:
             explicit X8DrawingEngine(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -105,6 +119,7 @@ namespace OpenRCT2
             void Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom) override;
             void BeginDraw() override;
             void EndDraw() override;
+            void EndDrawPipelined() override;
             void PaintWindows() override;
             void PaintWeather() override;
             void CopyRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy) override;
@@ -124,8 +139,9 @@ namespace OpenRCT2
             void ConfigureDirtyGrid();
             static void ResetWindowVisbilities();
             void DrawAllDirtyBlocks();
+            void CollectDirtyRegions();
             uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
-            void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
+            void DrawDirtyRegion(const DirtyRegion& region);
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
 #    pragma GCC diagnostic pop
@@ -139,6 +155,7 @@ namespace OpenRCT2
 
         public:
             explicit X8DrawingContext(X8DrawingEngine* engine);
+            X8DrawingContext(X8DrawingEngine* engine, rct_drawpixelinfo* dpi);
 
             IDrawingEngine* GetEngine() override;
 
@@ -45,6 +45,7 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -1278,6 +1279,57 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     return 0;
 }
 
+static int32_t cc_ttf_cache_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifndef NO_TTF
+    auto stats = ttf_get_cache_stats();
+    console.WriteFormatLine(
+        "Surfaces: %u cached, %u hits, %u misses", stats.SurfaceCount, stats.SurfaceHits, stats.SurfaceMisses);
+    console.WriteFormatLine("Widths: %u cached, %u hits, %u misses", stats.WidthCount, stats.WidthHits, stats.WidthMisses);
+#else
+    console.WriteLine("TrueType font support is not available in this build.");
+#endif
+    return 0;
+}
+
+static int32_t cc_plugin_stats(InteractiveConsole& console, const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& profiler = OpenRCT2::GetContext()->GetScriptEngine().GetProfiler();
+    if (argv.empty())
+    {
+        for (const auto& line : profiler.GetReport())
+        {
+            console.WriteLine(line);
+        }
+    }
+    else if (argv[0] == "reset")
+    {
+        profiler.Reset();
+        console.WriteLine("Plugin statistics have been reset.");
+    }
+    else if (argv[0] == "save" && argv.size() > 1)
+    {
+        try
+        {
+            profiler.SaveJson(argv[1].c_str());
+            console.WriteFormatLine("Plugin statistics saved to %s", argv[1].c_str());
+        }
+        catch (const std::exception& e)
+        {
+            console.WriteLineError(e.what());
+        }
+    }
+    else
+    {
+        return -1;
+    }
+#else
+    console.WriteLine("Plugin support is not available in this build.");
+#endif
+    return 0;
+}
+
 static int32_t cc_for_date([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     int32_t year = 0;
@@ -1795,6 +1847,8 @@ static constexpr const console_command console_command_table[] = {
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+    { "plugin_stats", cc_plugin_stats, "Shows the time spent and memory allocated by each plugin.",
+      "plugin_stats [reset | save <path>]" },
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
@@ -1806,6 +1860,7 @@ static constexpr const console_command console_command_table[] = {
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
     { "staff", cc_staff, "Staff management.", "staff <subcommand>" },
     { "terminate", cc_terminate, "Calls std::terminate(), for testing purposes only.", "terminate" },
+    { "ttf_cache_stats", cc_ttf_cache_stats, "Shows the hit and miss counts of the TrueType text caches.", "ttf_cache_stats" },
     { "variables", cc_variables, "Lists all the variables that can be used with get and sometimes set.", "variables" },
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]"},
@@ -940,7 +940,13 @@ static void viewport_paint_column(paint_session* session)
     {
         viewport_paint_weather_gloom(&session->DPI);
     }
+}
 
+/**
+ * Draws the parts of a column that are not safe to draw from the paint job threads (text) and releases the session.
+ */
+static void viewport_finish_column(paint_session* session)
+{
     if (session->PSStringHead != nullptr)
     {
         PaintDrawMoneyStructs(&session->DPI, session->PSStringHead);
@@ -1062,9 +1068,27 @@ void viewport_paint(
         _paintJobs->Join();
     }
 
+    // Columns do not overlap, so they can be drawn in parallel if the drawing engine allows it
+    auto drawingEngine = dpi->DrawingEngine;
+    if (useMultithreading && drawingEngine != nullptr && (drawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
+    {
+        for (auto column : _paintColumns)
+        {
+            _paintJobs->AddTask([column]() -> void { viewport_paint_column(column); });
+        }
+        _paintJobs->Join();
+    }
+    else
+    {
+        for (auto column : _paintColumns)
+        {
+            viewport_paint_column(column);
+        }
+    }
+
     for (auto column : _paintColumns)
     {
-        viewport_paint_column(column);
+        viewport_finish_column(column);
     }
 }
 
@@ -1471,7 +1495,7 @@ static bool is_pixel_present_rle(const uint8_t* esi, int16_t x_start_point, int1
 static bool is_sprite_interacted_with_palette_set(
     rct_drawpixelinfo* dpi, int32_t imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap)
 {
-    const rct_g1_element* g1 = gfx_get_g1_element(imageId & 0x7FFFF);
+    const rct_g1_element* g1 = gfx_get_g1_element_data(imageId & 0x7FFFF);
     if (g1 == nullptr)
     {
         return false;
@@ -86,6 +86,15 @@ namespace OpenRCT2
         update();
     }
 
+    FmtString::iterator::iterator(std::string_view s, size_t i, const token* t, size_t ti)
+        : str(s)
+        , index(i)
+        , tokens(t)
+        , tokenIndex(ti)
+    {
+        update();
+    }
+
     void FmtString::iterator::update()
     {
         auto i = index;
@@ -95,6 +104,12 @@ namespace OpenRCT2
             return;
         }
 
+        if (tokens != nullptr)
+        {
+            current = tokens[tokenIndex];
+            return;
+        }
+
         if (str[i] == '\n' || str[i] == '\r')
         {
             i++;
@@ -205,6 +220,7 @@ namespace OpenRCT2
         if (index < str.size())
         {
             index += current.text.size();
+            tokenIndex++;
             update();
         }
         return *this;
@@ -216,6 +232,7 @@ namespace OpenRCT2
         if (index < str.size())
         {
             index += current.text.size();
+            tokenIndex++;
             update();
         }
         return result;
@@ -242,16 +259,54 @@ namespace OpenRCT2
     {
     }
 
+    FmtString::FmtString(const CompiledFmtString& compiled)
+        : _str(compiled.Source)
+        , _compiled(&compiled)
+    {
+    }
+
     FmtString::iterator FmtString::begin() const
     {
+        if (_compiled != nullptr)
+        {
+            return iterator(_str, 0, _compiled->Tokens.data(), 0);
+        }
         return iterator(_str, 0);
     }
 
     FmtString::iterator FmtString::end() const
     {
+        if (_compiled != nullptr)
+        {
+            return iterator(_str, _str.size(), _compiled->Tokens.data(), _compiled->Tokens.size());
+        }
         return iterator(_str, _str.size());
     }
 
+    bool FmtString::IsVerbatim() const
+    {
+        return _compiled != nullptr && _compiled->IsVerbatim;
+    }
+
+    std::string_view FmtString::View() const
+    {
+        return _str;
+    }
+
+    CompiledFmtString::CompiledFmtString(std::string_view source)
+        : Source(source)
+    {
+        IsVerbatim = true;
+        for (const auto& t : FmtString(source))
+        {
+            Tokens.push_back(t);
+            if (FormatTokenTakesArgument(t.kind) || t.kind == FormatToken::Push16 || t.kind == FormatToken::Pop16)
+            {
+                IsVerbatim = false;
+            }
+        }
+    }
+
     std::string FmtString::WithoutFormatTokens() const
     {
         std::string result;
@@ -626,6 +681,11 @@ namespace OpenRCT2
 
     FmtString GetFmtStringById(rct_string_id id)
     {
+        auto compiled = language_get_compiled_string(id);
+        if (compiled != nullptr)
+        {
+            return FmtString(*compiled);
+        }
         auto fmtc = language_get_string(id);
         return FmtString(fmtc);
     }
@@ -673,6 +733,12 @@ namespace OpenRCT2
 
     static void FormatStringAny(FormatBuffer& ss, const FmtString& fmt, const std::vector<FormatArg_t>& args, size_t& argIndex)
     {
+        if (fmt.IsVerbatim())
+        {
+            ss << fmt.View();
+            return;
+        }
+
         for (const auto& token : fmt)
         {
             if (token.kind == FormatToken::StringId)
@@ -748,6 +814,9 @@ namespace OpenRCT2
 
     static void BuildAnyArgListFromLegacyArgBuffer(const FmtString& fmt, std::vector<FormatArg_t>& anyArgs, const void*& args)
     {
+        if (fmt.IsVerbatim())
+            return;
+
         for (const auto& t : fmt)
         {
             switch (t.kind)
@@ -800,9 +869,19 @@ namespace OpenRCT2
 
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, rct_string_id id, const void* args)
     {
+        auto fmt = GetFmtStringById(id);
+        if (fmt.IsVerbatim())
+        {
+            // No arguments to read or substitute, copy the string as is
+            auto str = fmt.View();
+            auto copyLen = std::min<size_t>(bufferLen - 1, str.size());
+            std::copy(str.data(), str.data() + copyLen, buffer);
+            buffer[copyLen] = '\0';
+            return str.size();
+        }
+
         thread_local std::vector<FormatArg_t> anyArgs;
         anyArgs.clear();
-        auto fmt = GetFmtStringById(id);
         BuildAnyArgListFromLegacyArgBuffer(fmt, anyArgs, args);
         return FormatStringAny(buffer, bufferLen, fmt, anyArgs);
     }
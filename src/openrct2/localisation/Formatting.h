@@ -147,11 +147,14 @@ namespace OpenRCT2
 
     using FormatArg_t = std::variant<uint16_t, int32_t, const char*, std::string>;
 
+    struct CompiledFmtString;
+
     class FmtString
     {
     private:
         std::string_view _str;
         std::string _strOwned;
+        const CompiledFmtString* _compiled{};
 
     public:
         struct token
@@ -173,11 +176,14 @@ namespace OpenRCT2
             std::string_view str;
             size_t index;
             token current;
+            const token* tokens{};
+            size_t tokenIndex{};
 
             void update();
 
         public:
             iterator(std::string_view s, size_t i);
+            iterator(std::string_view s, size_t i, const token* t, size_t ti);
             bool operator==(iterator& rhs);
             bool operator!=(iterator& rhs);
             token CreateToken(size_t len);
@@ -192,12 +198,34 @@ namespace OpenRCT2
         FmtString(std::string&& s);
         FmtString(std::string_view s);
         FmtString(const char* s);
+        FmtString(const CompiledFmtString& compiled);
         iterator begin() const;
         iterator end() const;
 
+        /**
+         * Whether formatting the string just reproduces it, i.e. it has no arguments and no stack codes.
+         * Only known for compiled strings.
+         */
+        bool IsVerbatim() const;
+        std::string_view View() const;
+
         std::string WithoutFormatTokens() const;
     };
 
+    /**
+     * A format string split into tokens once, e.g. when a language pack is loaded, so that formatting it does not have
+     * to tokenise it again. The tokens refer to the source string which must outlive this.
+     */
+    struct CompiledFmtString
+    {
+        std::string_view Source;
+        std::vector<FmtString::token> Tokens;
+        bool IsVerbatim{};
+
+        CompiledFmtString() = default;
+        explicit CompiledFmtString(std::string_view source);
+    };
+
     template<typename T> void FormatArgument(FormatBuffer& ss, FormatToken token, T arg);
 
     bool IsRealNameStringId(rct_string_id id);
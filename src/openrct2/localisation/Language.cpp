@@ -72,6 +72,12 @@ const char* language_get_string(rct_string_id id)
     return localisationService.GetString(id);
 }
 
+const OpenRCT2::CompiledFmtString* language_get_compiled_string(rct_string_id id)
+{
+    const auto& localisationService = OpenRCT2::GetContext()->GetLocalisationService();
+    return localisationService.GetCompiledString(id);
+}
+
 bool language_open(int32_t id)
 {
     auto context = OpenRCT2::GetContext();
@@ -92,8 +92,14 @@ constexpr const char* BlackLeftArrowString = u8"{BLACK}◀";
 constexpr const char* BlackRightArrowString = u8"{BLACK}▶";
 constexpr const char* CheckBoxMarkString = u8"✓";
 
+namespace OpenRCT2
+{
+    struct CompiledFmtString;
+}
+
 uint8_t language_get_id_from_locale(const char* locale);
 const char* language_get_string(rct_string_id id);
+const OpenRCT2::CompiledFmtString* language_get_compiled_string(rct_string_id id);
 bool language_open(int32_t id);
 
 uint32_t utf8_get_next(const utf8* char_ptr, const utf8** nextchar_ptr);
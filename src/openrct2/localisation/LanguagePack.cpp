@@ -16,6 +16,7 @@
 #include "../core/String.hpp"
 #include "../core/StringBuilder.h"
 #include "../core/StringReader.h"
+#include "Formatting.h"
 #include "Language.h"
 #include "Localisation.h"
 
@@ -51,6 +52,8 @@ class LanguagePack final : public ILanguagePack
 private:
     uint16_t const _id;
     std::vector<std::string> _strings;
+    // Tokenised form of each entry in _strings, see CompileString
+    std::vector<OpenRCT2::CompiledFmtString> _compiledStrings;
     std::vector<ObjectOverride> _objectOverrides;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
@@ -116,6 +119,13 @@ public:
         _currentGroup = std::string();
         _currentObjectOverride = nullptr;
         _currentScenarioOverride = nullptr;
+
+        // Tokenise every string up front, now that _strings will no longer be resized
+        _compiledStrings.resize(_strings.size());
+        for (size_t i = 0; i < _strings.size(); i++)
+        {
+            CompileString(i);
+        }
     }
 
     uint16_t GetId() const override
@@ -133,6 +143,7 @@ public:
         if (_strings.size() >= static_cast<size_t>(stringId))
         {
             _strings[stringId] = std::string();
+            CompileString(stringId);
         }
     }
 
@@ -141,7 +152,18 @@ public:
         if (_strings.size() >= static_cast<size_t>(stringId))
         {
             _strings[stringId] = str;
+            CompileString(stringId);
+        }
+    }
+
+    const OpenRCT2::CompiledFmtString* GetCompiledString(rct_string_id stringId) const override
+    {
+        // Only strings in _strings are compiled, overrides are tokenised when used
+        if (stringId < _compiledStrings.size() && !_strings[stringId].empty())
+        {
+            return &_compiledStrings[stringId];
         }
+        return nullptr;
     }
 
     const utf8* GetString(rct_string_id stringId) const override
@@ -235,6 +257,14 @@ public:
     }
 
 private:
+    void CompileString(size_t index)
+    {
+        if (index < _compiledStrings.size())
+        {
+            _compiledStrings[index] = OpenRCT2::CompiledFmtString(_strings[index]);
+        }
+    }
+
     ObjectOverride* GetObjectOverride(const std::string& objectIdentifier)
     {
         for (auto& oo : _objectOverrides)
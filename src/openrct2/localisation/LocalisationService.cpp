@@ -66,6 +66,25 @@ const char* LocalisationService::GetString(rct_string_id id) const
     return result;
 }
 
+/**
+ * Returns the pre-tokenised form of the string GetString would return, or nullptr if it is not available.
+ */
+const CompiledFmtString* LocalisationService::GetCompiledString(rct_string_id id) const
+{
+    if (id == STR_EMPTY || id == STR_NONE)
+        return nullptr;
+
+    // The compiled string must come from the same language pack GetString would pick
+    for (const auto* languagePack : { _languageCurrent.get(), _languageFallback.get() })
+    {
+        if (languagePack != nullptr && languagePack->GetString(id) != nullptr)
+        {
+            return languagePack->GetCompiledString(id);
+        }
+    }
+    return nullptr;
+}
+
 std::string LocalisationService::GetLanguagePath(uint32_t languageId) const
 {
     auto locale = std::string(LanguagesDescriptors[languageId].locale);
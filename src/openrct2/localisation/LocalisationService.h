@@ -22,8 +22,9 @@ struct IObjectManager;
 
 namespace OpenRCT2
 {
+    struct CompiledFmtString;
     struct IPlatformEnvironment;
-}
+} // namespace OpenRCT2
 
 namespace OpenRCT2::Localisation
 {
@@ -55,6 +56,7 @@ namespace OpenRCT2::Localisation
         ~LocalisationService();
 
         const char* GetString(rct_string_id id) const;
+        const CompiledFmtString* GetCompiledString(rct_string_id id) const;
         std::tuple<rct_string_id, rct_string_id, rct_string_id> GetLocalisedScenarioStrings(
             const std::string& scenarioFilename) const;
         rct_string_id GetObjectOverrideStringId(std::string_view legacyIdentifier, uint8_t index) const;
@@ -259,6 +259,7 @@ const std::array<NetworkAction, static_cast<size_t>(NetworkPermission::Count)> N
         "PERMISSION_MODIFY_TILE",
         {
             GameCommand::ModifyTile,
+            GameCommand::SetTileRegion,
         },
     },
     NetworkAction{
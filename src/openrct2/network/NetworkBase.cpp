@@ -14,6 +14,7 @@
 #include "../GameStateSnapshots.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../actions/BatchAction.h"
 #include "../actions/LoadOrQuitAction.h"
 #include "../actions/NetworkModifyGroupAction.h"
 #include "../actions/PeepPickupAction.h"
@@ -37,7 +38,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "20"
+#define NETWORK_STREAM_VERSION "22"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -2945,7 +2946,8 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         return;
     }
 
-    if (actionType != GameCommand::Custom)
+    // Batches are checked per action once they have been read
+    if (actionType != GameCommand::Custom && actionType != GameCommand::Batch)
     {
         // Check if player's group permission allows command to run
         NetworkGroup* group = GetGroupByID(connection.Player->Group);
@@ -2966,6 +2968,28 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         return;
     }
 
+    DataSerialiser stream(false);
+    const size_t size = packet.Header.Size - packet.BytesRead;
+    stream.GetStream().WriteArray(packet.Read(size), size);
+    stream.GetStream().SetPosition(0);
+
+    ga->Serialise(stream);
+
+    if (actionType == GameCommand::Batch)
+    {
+        // Every action in the batch needs the permission it would need on its own
+        NetworkGroup* group = GetGroupByID(connection.Player->Group);
+        for (const auto& subAction : static_cast<const BatchAction&>(*ga).GetActions())
+        {
+            auto subActionType = subAction->GetType();
+            if (subActionType != GameCommand::Custom && (group == nullptr || !group->CanPerformCommand(subActionType)))
+            {
+                Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+                return;
+            }
+        }
+    }
+
     // Player who is hosting is not affected by cooldowns.
     if ((player->Flags & NETWORK_PLAYER_FLAG_ISSERVER) == 0)
     {
@@ -2986,12 +3010,6 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         }
     }
 
-    DataSerialiser stream(false);
-    const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.GetStream().WriteArray(packet.Read(size), size);
-    stream.GetStream().SetPosition(0);
-
-    ga->Serialise(stream);
     // Set player to sender, should be 0 if sent from client.
     ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
 
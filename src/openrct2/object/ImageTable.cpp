@@ -24,8 +24,12 @@
 #include "ObjectFactory.h"
 
 #include <algorithm>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -80,6 +84,127 @@ struct ImageTable::RequiredImage
     }
 };
 
+/**
+ * Legacy objects that JSON objects borrow images from. Many of the official JSON objects take their images from the
+ * same DAT file, so each one is only read and decoded once. Objects are loaded on several threads, a thread that
+ * needs an object another thread is already decoding waits for it rather than decoding it again.
+ */
+class LegacyObjectCache
+{
+private:
+    // Bounds the memory held on to by the cache, objects are evicted least recently used first
+    static constexpr size_t MaxSize = 64 * 1024 * 1024;
+
+    struct Entry
+    {
+        std::shared_future<std::shared_ptr<const Object>> LoadedObject;
+        size_t Size{};
+        uint64_t LastUsed{};
+    };
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+    size_t _size{};
+    uint64_t _useCounter{};
+
+public:
+    std::shared_ptr<const Object> GetOrLoad(
+        const std::string& name, const std::function<std::unique_ptr<Object>()>& load)
+    {
+        std::promise<std::shared_ptr<const Object>> promise;
+        std::shared_future<std::shared_ptr<const Object>> future;
+        bool isLoader = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _entries.find(name);
+            if (it != _entries.end())
+            {
+                it->second.LastUsed = ++_useCounter;
+                future = it->second.LoadedObject;
+            }
+            else
+            {
+                future = promise.get_future().share();
+                _entries.emplace(name, Entry{ future, 0, ++_useCounter });
+                isLoader = true;
+            }
+        }
+
+        if (isLoader)
+        {
+            std::shared_ptr<const Object> object;
+            try
+            {
+                object = load();
+            }
+            catch (...)
+            {
+                // Pass the failure on to any waiting threads and let the next request try again
+                promise.set_exception(std::current_exception());
+                std::lock_guard<std::mutex> lock(_mutex);
+                _entries.erase(name);
+                throw;
+            }
+            promise.set_value(object);
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _entries.find(name);
+            if (it != _entries.end() && object != nullptr)
+            {
+                it->second.Size = GetImageDataSize(*object);
+                _size += it->second.Size;
+                Evict(name);
+            }
+        }
+        return future.get();
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries.clear();
+        _size = 0;
+    }
+
+private:
+    static size_t GetImageDataSize(const Object& object)
+    {
+        const auto& imageTable = object.GetImageTable();
+        const auto* images = imageTable.GetImages();
+        size_t size = 0;
+        for (uint32_t i = 0; i < imageTable.GetCount(); i++)
+        {
+            size += g1_calculate_data_size(&images[i]) + sizeof(rct_g1_element);
+        }
+        return size;
+    }
+
+    void Evict(const std::string& keepName)
+    {
+        while (_size > MaxSize)
+        {
+            // Entries still being decoded have no size yet and are left alone
+            auto lru = _entries.end();
+            for (auto it = _entries.begin(); it != _entries.end(); it++)
+            {
+                if (it->second.Size != 0 && it->first != keepName
+                    && (lru == _entries.end() || it->second.LastUsed < lru->second.LastUsed))
+                {
+                    lru = it;
+                }
+            }
+            if (lru == _entries.end())
+                break;
+
+            // Threads still holding the object keep it alive until they are done with it
+            _size -= lru->second.Size;
+            _entries.erase(lru);
+        }
+    }
+};
+
+static LegacyObjectCache _legacyObjectCache;
+
 std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(IReadObjectContext* context, std::string s)
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
@@ -189,11 +314,13 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
     IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
-    auto objectPath = FindLegacyObject(name);
-    auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
+    auto obj = _legacyObjectCache.GetOrLoad(name, [context, &name]() {
+        auto objectPath = FindLegacyObject(name);
+        return ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
+    });
     if (obj != nullptr)
     {
-        auto& imgTable = static_cast<const Object*>(obj.get())->GetImageTable();
+        auto& imgTable = obj->GetImageTable();
         auto numImages = static_cast<int32_t>(imgTable.GetCount());
         auto images = imgTable.GetImages();
         size_t placeHoldersAdded = 0;
@@ -220,7 +347,7 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
     }
     else
     {
-        std::string msg = "Unable to open '" + objectPath + "'";
+        std::string msg = "Unable to open '" + FindLegacyObject(name) + "'";
         context->LogWarning(ObjectError::InvalidProperty, msg.c_str());
         for (size_t i = 0; i < range.size(); i++)
         {
@@ -288,6 +415,11 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
     return objectPath;
 }
 
+void ImageTable::ClearLegacyObjectCache()
+{
+    _legacyObjectCache.Clear();
+}
+
 ImageTable::~ImageTable()
 {
     if (_data == nullptr)
@@ -447,3 +579,40 @@ void ImageTable::AddImage(const rct_g1_element* g1)
     }
     _entries.push_back(std::move(newg1));
 }
+
+size_t ImageTable::GetDataSize() const
+{
+    size_t size = 0;
+    for (const auto& entry : _entries)
+    {
+        if (entry.offset != nullptr)
+        {
+            size += g1_calculate_data_size(&entry);
+        }
+    }
+    return size;
+}
+
+void ImageTable::ReleaseData()
+{
+    if (_data == nullptr)
+    {
+        for (auto& entry : _entries)
+        {
+            delete[] entry.offset;
+        }
+    }
+    _data.reset();
+    for (auto& entry : _entries)
+    {
+        entry.offset = nullptr;
+    }
+}
+
+void ImageTable::TakeData(ImageTable& other)
+{
+    ReleaseData();
+    _data = std::move(other._data);
+    _entries = std::move(other._entries);
+    other._entries.clear();
+}
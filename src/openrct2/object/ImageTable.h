@@ -48,6 +48,12 @@ public:
     ImageTable& operator=(const ImageTable&) = delete;
     ~ImageTable();
 
+    /**
+     * Releases the legacy objects kept decoded for JSON objects that use their images, call once a batch of objects
+     * has been loaded.
+     */
+    static void ClearLegacyObjectCache();
+
     void Read(IReadObjectContext* context, OpenRCT2::IStream* stream);
     /**
      * @note root is deliberately left non-const: json_t behaviour changes when const
@@ -62,4 +68,14 @@ public:
         return static_cast<uint32_t>(_entries.size());
     }
     void AddImage(const rct_g1_element* g1);
+
+    size_t GetDataSize() const;
+    /**
+     * Frees the pixel data of the images, only their headers are kept.
+     */
+    void ReleaseData();
+    /**
+     * Takes over the images and their pixel data from a table read from the same object.
+     */
+    void TakeData(ImageTable& other);
 };
@@ -54,6 +54,37 @@ void Object::PopulateTablesFromJson(IReadObjectContext* context, json_t& root)
     _imageTable.ReadJson(context, root);
 }
 
+const rct_g1_element* Object::LoadImages()
+{
+    auto& objectRepository = GetContext()->GetObjectRepository();
+    const auto* item = IsJsonObject() ? objectRepository.FindObject(GetIdentifier())
+                                      : objectRepository.FindObject(GetObjectEntry());
+    if (item == nullptr)
+        return nullptr;
+
+    // Only the image table of the fresh copy is used, it will have the same images unless the file has changed
+    auto object = objectRepository.LoadObject(item);
+
+    // Reading the object may have decoded the legacy objects it takes images from, do not keep those around
+    ImageTable::ClearLegacyObjectCache();
+
+    if (object == nullptr || object->_imageTable.GetCount() != _imageTable.GetCount())
+        return nullptr;
+
+    _imageTable.TakeData(object->_imageTable);
+    return _imageTable.GetImages();
+}
+
+void Object::UnloadImages()
+{
+    _imageTable.ReleaseData();
+}
+
+size_t Object::GetImageDataSize() const
+{
+    return _imageTable.GetDataSize();
+}
+
 rct_object_entry Object::ParseObjectEntry(const std::string& s)
 {
     rct_object_entry entry = {};
@@ -247,7 +247,7 @@ struct IReadObjectContext
 #    pragma GCC diagnostic ignored "-Wsuggest-final-types"
 #    pragma GCC diagnostic ignored "-Wsuggest-final-methods"
 #endif
-class Object
+class Object : public IImageListSource
 {
 private:
     std::string _identifier;
@@ -355,6 +355,13 @@ public:
         return _imageTable;
     }
 
+    /**
+     * Images released to stay within the image memory budget are read back in from the object file.
+     */
+    const rct_g1_element* LoadImages() override;
+    void UnloadImages() override;
+    size_t GetImageDataSize() const override;
+
     ObjectEntryDescriptor GetScgWallsHeader() const;
     ObjectEntryDescriptor GetScgPathXHeader() const;
     rct_object_entry CreateHeader(const char name[9], uint32_t flags, uint32_t checksum);
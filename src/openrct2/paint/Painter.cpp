@@ -77,6 +77,9 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(dpi);
     }
+
+    // Nothing is drawn between frames, so this is when images that are not needed any more can be released
+    gfx_object_update_image_residency();
     gCurrentDrawCount++;
 }
 
@@ -132,19 +135,22 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 {
     paint_session* session = nullptr;
 
-    if (_freePaintSessions.empty() == false)
     {
-        // Re-use.
-        session = _freePaintSessions.back();
+        std::lock_guard<std::mutex> lock(_sessionMutex);
+        if (_freePaintSessions.empty() == false)
+        {
+            // Re-use.
+            session = _freePaintSessions.back();
 
-        // Shrink by one.
-        _freePaintSessions.pop_back();
-    }
-    else
-    {
-        // Create new one in pool.
-        _paintSessionPool.emplace_back(std::make_unique<paint_session>());
-        session = _paintSessionPool.back().get();
+            // Shrink by one.
+            _freePaintSessions.pop_back();
+        }
+        else
+        {
+            // Create new one in pool.
+            _paintSessionPool.emplace_back(std::make_unique<paint_session>());
+            session = _paintSessionPool.back().get();
+        }
     }
 
     session->DPI = *dpi;
@@ -168,5 +174,7 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
 void Painter::ReleaseSession(paint_session* session)
 {
     session->PaintEntryChain.Clear();
+
+    std::lock_guard<std::mutex> lock(_sessionMutex);
     _freePaintSessions.push_back(session);
 }
@@ -1838,6 +1838,110 @@ Ride* Guest::FindBestRideToGoOn()
     return mostExcitingRide;
 }
 
+// Per tile summary of the tile elements guests look at when choosing a ride or assessing their surroundings,
+// so that they do not have to walk the tile elements of every tile around them. Tiles are summarised again
+// lazily once their elements change.
+static constexpr ride_id_t TrackRideNone = RIDE_ID_NULL;
+static constexpr ride_id_t TrackRideMultiple = RIDE_ID_NULL - 1;
+
+struct TileGuestSummary
+{
+    // Ride owning the track on this tile, TrackRideNone or TrackRideMultiple
+    ride_id_t TrackRide;
+    uint16_t NumScenery;
+    uint16_t NumFountains;
+    uint16_t NumBrokenAdditions;
+    bool HasInvalidAddition;
+};
+
+static std::vector<TileGuestSummary> _tileGuestSummaries;
+static uint32_t _tileGuestSummariesGeneration;
+
+static void summarise_tile(TileGuestSummary& summary, const CoordsXY& loc)
+{
+    summary = { TrackRideNone, 0, 0, 0, false };
+    for (auto* tileElement : TileElementsView(loc))
+    {
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_PATH:
+            {
+                auto* pathElement = tileElement->AsPath();
+                if (!pathElement->HasAddition())
+                    break;
+
+                auto* pathAddEntry = pathElement->GetAdditionEntry();
+                if (pathAddEntry == nullptr)
+                {
+                    summary.HasInvalidAddition = true;
+                    break;
+                }
+                if (pathElement->AdditionIsGhost())
+                    break;
+
+                if (pathAddEntry->flags & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
+                {
+                    summary.NumFountains++;
+                    break;
+                }
+                if (pathElement->IsBroken())
+                {
+                    summary.NumBrokenAdditions++;
+                }
+                break;
+            }
+            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                summary.NumScenery++;
+                break;
+            case TILE_ELEMENT_TYPE_TRACK:
+            {
+                auto rideIndex = tileElement->AsTrack()->GetRideIndex();
+                if (rideIndex >= MAX_RIDES)
+                    summary.TrackRide = TrackRideMultiple;
+                else if (summary.TrackRide == TrackRideNone)
+                    summary.TrackRide = rideIndex;
+                else if (summary.TrackRide != rideIndex)
+                    summary.TrackRide = TrackRideMultiple;
+                break;
+            }
+        }
+    }
+}
+
+static const TileGuestSummary& get_tile_guest_summary(const CoordsXY& loc)
+{
+    auto generation = GetTileElementsGeneration();
+    if (_tileGuestSummaries.empty() || generation != _tileGuestSummariesGeneration)
+    {
+        static std::vector<TileCoordsXY> changedTiles;
+        if (!TakeChangedTiles(changedTiles) || _tileGuestSummaries.empty())
+        {
+            _tileGuestSummaries.resize(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL);
+            for (int32_t tileY = 0; tileY < MAXIMUM_MAP_SIZE_TECHNICAL; tileY++)
+            {
+                for (int32_t tileX = 0; tileX < MAXIMUM_MAP_SIZE_TECHNICAL; tileX++)
+                {
+                    auto& summary = _tileGuestSummaries[tileY * MAXIMUM_MAP_SIZE_TECHNICAL + tileX];
+                    summarise_tile(summary, TileCoordsXY{ tileX, tileY }.ToCoordsXY());
+                }
+            }
+        }
+        else
+        {
+            for (const auto& tile : changedTiles)
+            {
+                auto& summary = _tileGuestSummaries[tile.y * MAXIMUM_MAP_SIZE_TECHNICAL + tile.x];
+                summarise_tile(summary, tile.ToCoordsXY());
+            }
+        }
+        _tileGuestSummariesGeneration = generation;
+    }
+
+    auto tileCoords = TileCoordsXY{ loc };
+    return _tileGuestSummaries[tileCoords.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileCoords.x];
+}
+
 std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
 {
     std::bitset<MAX_RIDES> rideConsideration;
@@ -1870,6 +1974,16 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
                 if (!map_is_location_valid(location))
                     continue;
 
+                auto tileRide = get_tile_guest_summary(location).TrackRide;
+                if (tileRide == TrackRideNone)
+                    continue;
+
+                if (tileRide != TrackRideMultiple)
+                {
+                    rideConsideration[tileRide] = true;
+                    continue;
+                }
+
                 for (auto* trackElement : TileElementsView<TrackElement>(location))
                 {
                     auto rideIndex = trackElement->GetRideIndex();
@@ -2861,6 +2975,33 @@ static bool peep_really_liked_ride(Guest* peep, Ride* ride)
     return true;
 }
 
+/**
+ * Returns the music flags a guest assessing their surroundings picks up from track of the given ride:
+ * 1 for music they enjoy and 2 for dodgems drowning it out.
+ */
+static uint16_t peep_get_ride_music_type(const Ride* ride)
+{
+    if (ride == nullptr)
+        return 0;
+
+    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC) || ride->status == RideStatus::Closed
+        || (ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
+        return 0;
+
+    if (ride->type == RIDE_TYPE_MERRY_GO_ROUND)
+        return 1;
+
+    if (ride->music == MUSIC_STYLE_ORGAN)
+        return 1;
+
+    if (ride->type == RIDE_TYPE_DODGEMS)
+    {
+        // Dodgems drown out music?
+        return 2;
+    }
+    return 0;
+}
+
 /**
  *
  *  rct2: 0x0069BC9A
@@ -2884,79 +3025,48 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     {
         for (int16_t y = initial_y; y < final_y; y += COORDS_XY_STEP)
         {
-            for (auto* tileElement : TileElementsView({ x, y }))
-            {
-                Ride* ride;
+            const auto& summary = get_tile_guest_summary({ x, y });
+            if (summary.HasInvalidAddition)
+                return PeepThoughtType::None;
 
-                switch (tileElement->GetType())
-                {
-                    case TILE_ELEMENT_TYPE_PATH:
-                    {
-                        if (!tileElement->AsPath()->HasAddition())
-                            break;
+            num_scenery += summary.NumScenery;
+            num_fountains += summary.NumFountains;
+            num_rubbish += summary.NumBrokenAdditions;
 
-                        auto* pathAddEntry = tileElement->AsPath()->GetAdditionEntry();
-                        if (pathAddEntry == nullptr)
-                        {
-                            return PeepThoughtType::None;
-                        }
-                        if (tileElement->AsPath()->AdditionIsGhost())
-                            break;
+            if (summary.TrackRide == TrackRideNone)
+                continue;
 
-                        if (pathAddEntry->flags & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
-                        {
-                            num_fountains++;
-                            break;
-                        }
-                        if (tileElement->AsPath()->IsBroken())
-                        {
-                            num_rubbish++;
-                        }
-                        break;
-                    }
-                    case TILE_ELEMENT_TYPE_LARGE_SCENERY:
-                    case TILE_ELEMENT_TYPE_SMALL_SCENERY:
-                        num_scenery++;
-                        break;
-                    case TILE_ELEMENT_TYPE_TRACK:
-                        ride = get_ride(tileElement->AsTrack()->GetRideIndex());
-                        if (ride != nullptr)
-                        {
-                            if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride->status != RideStatus::Closed
-                                && !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
-                            {
-                                if (ride->type == RIDE_TYPE_MERRY_GO_ROUND)
-                                {
-                                    nearby_music |= 1;
-                                    break;
-                                }
-
-                                if (ride->music == MUSIC_STYLE_ORGAN)
-                                {
-                                    nearby_music |= 1;
-                                    break;
-                                }
-
-                                if (ride->type == RIDE_TYPE_DODGEMS)
-                                {
-                                    // Dodgems drown out music?
-                                    nearby_music |= 2;
-                                }
-                            }
-                        }
-                        break;
-                }
+            if (summary.TrackRide != TrackRideMultiple)
+            {
+                nearby_music |= peep_get_ride_music_type(get_ride(summary.TrackRide));
+                continue;
+            }
+
+            for (auto* trackElement : TileElementsView<TrackElement>({ x, y }))
+            {
+                nearby_music |= peep_get_ride_music_type(get_ride(trackElement->GetRideIndex()));
             }
         }
     }
 
-    for (auto litter : EntityList<Litter>())
+    // Litter is only counted within 160 units of the centre, so only the tiles that can hold such litter are checked
+    int32_t litterMinTileX = std::max(centre_x - 160, 0) / COORDS_XY_STEP;
+    int32_t litterMinTileY = std::max(centre_y - 160, 0) / COORDS_XY_STEP;
+    int32_t litterMaxTileX = std::min(centre_x + 160, MAXIMUM_MAP_SIZE_BIG - 1) / COORDS_XY_STEP;
+    int32_t litterMaxTileY = std::min(centre_y + 160, MAXIMUM_MAP_SIZE_BIG - 1) / COORDS_XY_STEP;
+    for (int32_t tileX = litterMinTileX; tileX <= litterMaxTileX; tileX++)
     {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
+        for (int32_t tileY = litterMinTileY; tileY <= litterMaxTileY; tileY++)
         {
-            num_rubbish++;
+            for (auto litter : EntityTileList<Litter>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                int16_t dist_x = abs(litter->x - centre_x);
+                int16_t dist_y = abs(litter->y - centre_y);
+                if (std::max(dist_x, dist_y) <= 160)
+                {
+                    num_rubbish++;
+                }
+            }
         }
     }
 
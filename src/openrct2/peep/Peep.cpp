@@ -992,73 +992,75 @@ void Peep::Update()
  *
  *  rct2: 0x0069BF41
  */
-void peep_problem_warnings_update()
+GuestStatistics peep_gather_guest_statistics()
 {
-    Ride* ride;
-    uint32_t hunger_counter = 0, lost_counter = 0, noexit_counter = 0, thirst_counter = 0, litter_counter = 0,
-             disgust_counter = 0, toilet_counter = 0, vandalism_counter = 0;
-    uint8_t* warning_throttle = gPeepWarningThrottle;
-
+    GuestStatistics statistics{};
     for (auto peep : EntityList<Guest>())
     {
-        if (peep->OutsideOfPark || peep->Thoughts[0].freshness > 5)
-            continue;
-
-        switch (peep->Thoughts[0].type)
+        if (peep->FavouriteRide != RIDE_ID_NULL && peep->FavouriteRide < MAX_RIDES)
         {
-            case PeepThoughtType::Lost: // 0x10
-                lost_counter++;
-                break;
+            statistics.FavouriteRides[peep->FavouriteRide]++;
+        }
 
-            case PeepThoughtType::Hungry: // 0x14
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    hunger_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_FLAT_RIDE))
-                    hunger_counter++;
-                break;
+        if (peep->OutsideOfPark)
+            continue;
 
-            case PeepThoughtType::Thirsty:
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    thirst_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_DRINKS))
-                    thirst_counter++;
-                break;
+        statistics.InPark++;
 
-            case PeepThoughtType::Toilet:
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    toilet_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_TOILET))
-                    toilet_counter++;
-                break;
+        if (peep->Thoughts[0].freshness > 5)
+            continue;
 
-            case PeepThoughtType::BadLitter: // 0x1a
-                litter_counter++;
-                break;
-            case PeepThoughtType::CantFindExit: // 0x1b
-                noexit_counter++;
+        const auto thoughtType = peep->Thoughts[0].type;
+        statistics.FreshThoughts[EnumValue(thoughtType)]++;
+
+        uint64_t servingFlag = 0;
+        uint32_t* unserved = nullptr;
+        switch (thoughtType)
+        {
+            case PeepThoughtType::Hungry:
+                servingFlag = RIDE_TYPE_FLAG_FLAT_RIDE;
+                unserved = &statistics.UnservedHungry;
                 break;
-            case PeepThoughtType::PathDisgusting: // 0x1f
-                disgust_counter++;
+            case PeepThoughtType::Thirsty:
+                servingFlag = RIDE_TYPE_FLAG_SELLS_DRINKS;
+                unserved = &statistics.UnservedThirsty;
                 break;
-            case PeepThoughtType::Vandalism: // 0x21
-                vandalism_counter++;
+            case PeepThoughtType::Toilet:
+                servingFlag = RIDE_TYPE_FLAG_IS_TOILET;
+                unserved = &statistics.UnservedToilet;
                 break;
             default:
                 break;
         }
+        if (unserved != nullptr)
+        {
+            if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
+            {
+                (*unserved)++;
+            }
+            else
+            {
+                auto ride = get_ride(peep->GuestHeadingToRideId);
+                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(servingFlag))
+                    (*unserved)++;
+            }
+        }
     }
+    return statistics;
+}
+
+void peep_problem_warnings_update(const GuestStatistics& statistics)
+{
+    const uint32_t hunger_counter = statistics.UnservedHungry;
+    const uint32_t lost_counter = statistics.GetFreshThoughtCount(PeepThoughtType::Lost);
+    const uint32_t noexit_counter = statistics.GetFreshThoughtCount(PeepThoughtType::CantFindExit);
+    const uint32_t thirst_counter = statistics.UnservedThirsty;
+    const uint32_t litter_counter = statistics.GetFreshThoughtCount(PeepThoughtType::BadLitter);
+    const uint32_t disgust_counter = statistics.GetFreshThoughtCount(PeepThoughtType::PathDisgusting);
+    const uint32_t toilet_counter = statistics.UnservedToilet;
+    const uint32_t vandalism_counter = statistics.GetFreshThoughtCount(PeepThoughtType::Vandalism);
+    uint8_t* warning_throttle = gPeepWarningThrottle;
+
     // could maybe be packed into a loop, would lose a lot of clarity though
     if (warning_throttle[0])
         --warning_throttle[0];
@@ -1191,6 +1193,10 @@ void peep_update_crowd_noise()
             continue;
 
         visiblePeeps += peep->State == PeepState::Queuing ? 1 : 2;
+
+        // The volume stops increasing beyond this, so there is no need to look at the rest of a large crowd
+        if (visiblePeeps >= (120 + 6) * 2)
+            break;
     }
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
@@ -21,6 +21,7 @@
 #include "../world/SpriteBase.h"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <optional>
 
@@ -996,9 +997,33 @@ extern uint32_t gNextGuestNumber;
 
 extern uint8_t gPeepWarningThrottle[16];
 
+/**
+ * Aggregate guest counts used by the awards, guest warnings and ride favourites, gathered in a single walk over all
+ * guests instead of one walk per consumer.
+ */
+struct GuestStatistics
+{
+    // Guests inside the park
+    uint32_t InPark;
+    // Guests inside the park thinking they are hungry, thirsty or need the toilet while not heading to a ride providing it
+    uint32_t UnservedHungry;
+    uint32_t UnservedThirsty;
+    uint32_t UnservedToilet;
+    // Guests inside the park whose most recent thought is fresh, by thought type
+    std::array<uint32_t, 256> FreshThoughts;
+    // All guests, by favourite ride
+    std::array<uint16_t, MAX_RIDES> FavouriteRides;
+
+    uint32_t GetFreshThoughtCount(PeepThoughtType type) const
+    {
+        return FreshThoughts[EnumValue(type)];
+    }
+};
+
+GuestStatistics peep_gather_guest_statistics();
 int32_t peep_get_staff_count();
 void peep_update_all();
-void peep_problem_warnings_update();
+void peep_problem_warnings_update(const GuestStatistics& statistics);
 void peep_stop_crowd_noise();
 void peep_update_crowd_noise();
 void peep_update_days_in_queue();
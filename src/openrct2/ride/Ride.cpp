@@ -73,6 +73,7 @@
 #include <iterator>
 #include <limits>
 #include <optional>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 
@@ -309,30 +310,36 @@ int32_t Ride::GetMaxQueueTime() const
     return static_cast<int32_t>(queueTime);
 }
 
-Guest* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
+/**
+ * Walks a station queue from the back to the front, returning the guest at the front and counting the guests on the
+ * way so that callers needing both only walk the queue once.
+ */
+static Guest* ride_station_queue_walk(const RideStation& station, uint16_t& length)
 {
     Guest* peep;
     Guest* result = nullptr;
-    uint16_t spriteIndex = stations[stationIndex].LastPeepInQueue;
+    length = 0;
+    uint16_t spriteIndex = station.LastPeepInQueue;
     while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
     {
         spriteIndex = peep->GuestNextInQueue;
         result = peep;
+        length++;
     }
     return result;
 }
 
+Guest* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
+{
+    uint16_t length;
+    return ride_station_queue_walk(stations[stationIndex], length);
+}
+
 void Ride::UpdateQueueLength(StationIndex stationIndex)
 {
-    uint16_t count = 0;
-    Guest* peep;
-    uint16_t spriteIndex = stations[stationIndex].LastPeepInQueue;
-    while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
-    {
-        spriteIndex = peep->GuestNextInQueue;
-        count++;
-    }
-    stations[stationIndex].QueueLength = count;
+    uint16_t length;
+    ride_station_queue_walk(stations[stationIndex], length);
+    stations[stationIndex].QueueLength = length;
 }
 
 void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
@@ -340,38 +347,35 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     assert(stationIndex < MAX_STATIONS);
     assert(peep != nullptr);
 
+    auto& station = stations[peep->CurrentRideStation];
     peep->GuestNextInQueue = SPRITE_INDEX_NULL;
-    auto* queueHeadGuest = GetQueueHeadGuest(peep->CurrentRideStation);
+
+    uint16_t length;
+    auto* queueHeadGuest = ride_station_queue_walk(station, length);
     if (queueHeadGuest == nullptr)
     {
-        stations[peep->CurrentRideStation].LastPeepInQueue = peep->sprite_index;
+        station.LastPeepInQueue = peep->sprite_index;
     }
     else
     {
         queueHeadGuest->GuestNextInQueue = peep->sprite_index;
     }
-    UpdateQueueLength(peep->CurrentRideStation);
+    // The guest is now at the front of the queue, behind everyone already counted
+    station.QueueLength = length + 1;
 }
 
 /**
  *
  *  rct2: 0x006AC916
  */
-void ride_update_favourited_stat()
+void ride_update_favourited_stat(const GuestStatistics& statistics)
 {
     for (auto& ride : GetRideManager())
-        ride.guests_favourite = 0;
-
-    for (auto peep : EntityList<Guest>())
     {
-        if (peep->FavouriteRide != RIDE_ID_NULL)
+        ride.guests_favourite = statistics.FavouriteRides[ride.id];
+        if (ride.guests_favourite != 0)
         {
-            auto ride = get_ride(peep->FavouriteRide);
-            if (ride != nullptr)
-            {
-                ride->guests_favourite++;
-                ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
-            }
+            ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
         }
     }
 
@@ -481,6 +485,88 @@ bool ride_try_get_origin_element(const Ride* ride, CoordsXYE* output)
     return resultTileElement != nullptr;
 }
 
+/**
+ * The parts of a track element that decide which pieces it connects to. Other parts such as door states or photo
+ * timeouts change in place all the time and must not invalidate cached links.
+ */
+struct TrackLinkKey
+{
+    uint8_t Type;
+    track_type_t TrackType;
+    uint8_t Sequence;
+    uint8_t Direction;
+    uint8_t BaseHeight;
+    ride_id_t RideIndex;
+    bool Ghost;
+
+    static TrackLinkKey From(const TileElement& element)
+    {
+        auto trackElement = element.AsTrack();
+        if (trackElement == nullptr)
+        {
+            return { element.GetType(), 0, 0, element.GetDirection(), element.base_height, RIDE_ID_NULL, element.IsGhost() };
+        }
+        return { element.GetType(),          trackElement->GetTrackType(), trackElement->GetSequenceIndex(),
+                 element.GetDirection(),     element.base_height,          trackElement->GetRideIndex(),
+                 element.IsGhost() };
+    }
+
+    bool operator==(const TrackLinkKey& other) const
+    {
+        return Type == other.Type && TrackType == other.TrackType && Sequence == other.Sequence
+            && Direction == other.Direction && BaseHeight == other.BaseHeight && RideIndex == other.RideIndex
+            && Ghost == other.Ghost;
+    }
+};
+
+struct TrackNextLink
+{
+    CoordsXY InputPos;
+    TrackLinkKey Input;
+    CoordsXYE Output;
+    TrackLinkKey OutputKey;
+    int32_t Z;
+    int32_t Direction;
+};
+
+struct TrackPreviousLink
+{
+    CoordsXY InputPos;
+    TrackLinkKey Input;
+    track_begin_end Output;
+    TrackLinkKey OutputKey;
+};
+
+/**
+ * Resolved links between connected track pieces, keyed by the element the link was looked up from. Everything is
+ * dropped when tile elements are inserted, removed or moved. Each link also remembers the connection relevant parts of
+ * both of its elements, so any in place change to those is caught as well.
+ */
+struct TrackLinkCache
+{
+    uint32_t Generation = 0;
+    std::unordered_map<const TileElement*, TrackNextLink> Next;
+    std::unordered_map<const TileElement*, TrackPreviousLink> Previous;
+
+    void Validate()
+    {
+        auto generation = GetTileElementsGeneration();
+        if (Generation != generation)
+        {
+            Generation = generation;
+            Next.clear();
+            Previous.clear();
+        }
+    }
+};
+
+static TrackLinkCache& GetTrackLinkCache()
+{
+    thread_local TrackLinkCache cache;
+    cache.Validate();
+    return cache;
+}
+
 /**
  *
  * rct2: 0x006C6096
@@ -567,6 +653,27 @@ bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32
     if (inputElement == nullptr)
         return false;
 
+    // input and output may be the same, so take everything needed from the input first
+    const TileElement* inputTileElement = input->element;
+    const CoordsXY inputPos = *input;
+    const auto inputKey = TrackLinkKey::From(*inputTileElement);
+
+    auto& cache = GetTrackLinkCache();
+    auto cached = cache.Next.find(inputTileElement);
+    if (cached != cache.Next.end())
+    {
+        const auto& link = cached->second;
+        if (link.InputPos == inputPos && link.Input == inputKey && link.OutputKey == TrackLinkKey::From(*link.Output.element))
+        {
+            *output = link.Output;
+            if (z != nullptr)
+                *z = link.Z;
+            if (direction != nullptr)
+                *direction = link.Direction;
+            return true;
+        }
+    }
+
     auto rideIndex = inputElement->GetRideIndex();
     auto ride = get_ride(rideIndex);
     if (ride == nullptr)
@@ -598,7 +705,28 @@ bool track_block_get_next(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32
     uint8_t directionStart = ((trackCoordinate.rotation_end + rotation) & TILE_ELEMENT_DIRECTION_MASK)
         | (trackCoordinate.rotation_end & TRACK_BLOCK_2);
 
-    return track_block_get_next_from_zero({ coords, OriginZ }, ride, directionStart, output, z, direction, false);
+    // Only links that were found are cached, failures are rare and do not always fill in every output
+    CoordsXYE nextOutput = *output;
+    int32_t nextZ = z != nullptr ? *z : 0;
+    int32_t nextDirection = direction != nullptr ? *direction : 0;
+    if (!track_block_get_next_from_zero({ coords, OriginZ }, ride, directionStart, &nextOutput, &nextZ, &nextDirection, false))
+    {
+        *output = nextOutput;
+        if (z != nullptr)
+            *z = nextZ;
+        if (direction != nullptr)
+            *direction = nextDirection;
+        return false;
+    }
+
+    cache.Next[inputTileElement] = { inputPos, inputKey, nextOutput, TrackLinkKey::From(*nextOutput.element), nextZ,
+                                     nextDirection };
+    *output = nextOutput;
+    if (z != nullptr)
+        *z = nextZ;
+    if (direction != nullptr)
+        *direction = nextDirection;
+    return true;
 }
 
 /**
@@ -711,6 +839,23 @@ bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTra
     if (trackElement == nullptr)
         return false;
 
+    const auto inputKey = TrackLinkKey::From(*trackPos.element);
+    auto& cache = GetTrackLinkCache();
+    auto cached = cache.Previous.find(trackPos.element);
+    if (cached != cache.Previous.end())
+    {
+        const auto& link = cached->second;
+        if (link.InputPos == CoordsXY{ trackPos } && link.Input == inputKey
+            && link.OutputKey == TrackLinkKey::From(*link.Output.begin_element))
+        {
+            // end_element is never written by the lookup, so the caller's value is kept
+            auto endElement = outTrackBeginEnd->end_element;
+            *outTrackBeginEnd = link.Output;
+            outTrackBeginEnd->end_element = endElement;
+            return true;
+        }
+    }
+
     auto rideIndex = trackElement->GetRideIndex();
     auto ride = get_ride(rideIndex);
     if (ride == nullptr)
@@ -737,7 +882,12 @@ bool track_block_get_previous(const CoordsXYE& trackPos, track_begin_end* outTra
     rotation = ((trackCoordinate.rotation_begin + rotation) & TILE_ELEMENT_DIRECTION_MASK)
         | (trackCoordinate.rotation_begin & TRACK_BLOCK_2);
 
-    return track_block_get_previous_from_zero({ coords, z }, ride, rotation, outTrackBeginEnd);
+    if (!track_block_get_previous_from_zero({ coords, z }, ride, rotation, outTrackBeginEnd))
+        return false;
+
+    cache.Previous[trackPos.element] = { trackPos, inputKey, *outTrackBeginEnd,
+                                         TrackLinkKey::From(*outTrackBeginEnd->begin_element) };
+    return true;
 }
 
 /**
@@ -2724,6 +2874,31 @@ Staff* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
     return find_closest_mechanic(centreMapLocation, forInspection);
 }
 
+/**
+ * Returns the sprite indices of all mechanics in sprite_index order. Staff types are fixed once hired so the
+ * list only needs rebuilding when staff are hired, fired or loaded.
+ */
+static const std::vector<uint16_t>& get_mechanic_indices()
+{
+    static std::vector<uint16_t> mechanicIndices;
+    static uint32_t mechanicIndicesGeneration = 0;
+    static bool mechanicIndicesValid = false;
+
+    auto generation = GetEntityListGeneration(EntityType::Staff);
+    if (!mechanicIndicesValid || generation != mechanicIndicesGeneration)
+    {
+        mechanicIndices.clear();
+        for (auto peep : EntityList<Staff>())
+        {
+            if (peep->IsMechanic())
+                mechanicIndices.push_back(peep->sprite_index);
+        }
+        mechanicIndicesGeneration = generation;
+        mechanicIndicesValid = true;
+    }
+    return mechanicIndices;
+}
+
 /**
  *
  *  rct2: 0x006B774B (forInspection = 0)
@@ -2734,9 +2909,15 @@ Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspec
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
-    for (auto peep : EntityList<Staff>())
+    // Patrol areas are only checked for locations inside the park, which is owned land, so no mechanic needs to
+    // test the ownership again
+    auto location = entrancePosition.ToTileStart();
+    bool checkPatrol = map_is_location_in_park(location);
+
+    for (auto spriteIndex : get_mechanic_indices())
     {
-        if (!peep->IsMechanic())
+        auto peep = GetEntity<Staff>(spriteIndex);
+        if (peep == nullptr || !peep->IsMechanic())
             continue;
 
         if (!forInspection)
@@ -2758,10 +2939,8 @@ Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspec
                 continue;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (map_is_location_in_park(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
+        if (checkPatrol && gStaffModes[peep->StaffId] == StaffMode::Patrol && !peep->IsPatrolAreaSet(location))
+            continue;
 
         if (peep->x == LOCATION_NULL)
             continue;
@@ -29,6 +29,7 @@ class StationObject;
 struct Ride;
 struct RideTypeDescriptor;
 struct Guest;
+struct GuestStatistics;
 struct Staff;
 struct Vehicle;
 
@@ -1122,7 +1123,7 @@ extern uint8_t gLastEntranceStyle;
 int32_t ride_get_count();
 void ride_init_all();
 void reset_all_ride_build_dates();
-void ride_update_favourited_stat();
+void ride_update_favourited_stat(const GuestStatistics& statistics);
 void ride_check_all_reachable();
 void ride_update_satisfaction(Ride* ride, uint8_t happiness);
 void ride_update_popularity(Ride* ride, uint8_t pop_amount);
@@ -744,7 +744,10 @@ static void ride_ratings_calculate(RideRatingUpdateState& state, Ride* ride)
 
 #ifdef ENABLE_SCRIPTING
     auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
-    if (hookEngine.HasSubscriptions(HOOK_TYPE::RIDE_RATINGS_CALCULATE))
+
+    HookEventInfo info;
+    info.RideId = ride->id;
+    if (hookEngine.HasSubscriptions(HOOK_TYPE::RIDE_RATINGS_CALCULATE, info))
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
         auto originalExcitement = ride->excitement;
@@ -760,7 +763,7 @@ static void ride_ratings_calculate(RideRatingUpdateState& state, Ride* ride)
 
         // Call the subscriptions
         auto e = obj.Take();
-        hookEngine.Call(HOOK_TYPE::RIDE_RATINGS_CALCULATE, e, true);
+        hookEngine.Call(HOOK_TYPE::RIDE_RATINGS_CALCULATE, info, e, true);
 
         auto scriptExcitement = AsOrDefault(e["excitement"], static_cast<int32_t>(originalExcitement));
         auto scriptIntensity = AsOrDefault(e["intensity"], static_cast<int32_t>(originalIntensity));
@@ -320,9 +320,11 @@ static void scenario_week_update()
     finance_pay_research();
     finance_pay_interest();
     marketing_update();
-    peep_problem_warnings_update();
+
+    auto guestStatistics = peep_gather_guest_statistics();
+    peep_problem_warnings_update(guestStatistics);
     ride_check_all_reachable();
-    ride_update_favourited_stat();
+    ride_update_favourited_stat(guestStatistics);
 
     auto water_type = static_cast<rct_water_type*>(object_entry_get_chunk(ObjectType::Water, 0));
 
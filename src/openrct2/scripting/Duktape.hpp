@@ -344,6 +344,11 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    template<> MapRange inline FromDuk(const DukValue& d)
+    {
+        return MapRange(FromDuk<CoordsXY>(d["leftTop"]), FromDuk<CoordsXY>(d["rightBottom"])).Normalise();
+    }
+
     template<> DukValue inline ToDuk(duk_context* ctx, const CoordsXY& coords)
     {
         DukObject dukCoords(ctx);
@@ -13,27 +13,70 @@
 
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
 
+static const std::unordered_map<std::string, HOOK_TYPE> HookTypeLookupTable({
+    { "action.query", HOOK_TYPE::ACTION_QUERY },
+    { "action.execute", HOOK_TYPE::ACTION_EXECUTE },
+    { "interval.tick", HOOK_TYPE::INTERVAL_TICK },
+    { "interval.day", HOOK_TYPE::INTERVAL_DAY },
+    { "network.chat", HOOK_TYPE::NETWORK_CHAT },
+    { "network.authenticate", HOOK_TYPE::NETWORK_AUTHENTICATE },
+    { "network.join", HOOK_TYPE::NETWORK_JOIN },
+    { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
+    { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
+    { "action.location", HOOK_TYPE::ACTION_LOCATION },
+    { "guest.generation", HOOK_TYPE::GUEST_GENERATION },
+});
+
 HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
 {
-    static const std::unordered_map<std::string, HOOK_TYPE> LookupTable({
-        { "action.query", HOOK_TYPE::ACTION_QUERY },
-        { "action.execute", HOOK_TYPE::ACTION_EXECUTE },
-        { "interval.tick", HOOK_TYPE::INTERVAL_TICK },
-        { "interval.day", HOOK_TYPE::INTERVAL_DAY },
-        { "network.chat", HOOK_TYPE::NETWORK_CHAT },
-        { "network.authenticate", HOOK_TYPE::NETWORK_AUTHENTICATE },
-        { "network.join", HOOK_TYPE::NETWORK_JOIN },
-        { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
-        { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
-        { "action.location", HOOK_TYPE::ACTION_LOCATION },
-        { "guest.generation", HOOK_TYPE::GUEST_GENERATION },
-    });
-    auto result = LookupTable.find(name);
-    return (result != LookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
+    auto result = HookTypeLookupTable.find(name);
+    return (result != HookTypeLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
+}
+
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    auto result = std::find_if(
+        HookTypeLookupTable.begin(), HookTypeLookupTable.end(), [type](const auto& entry) { return entry.second == type; });
+    return (result != HookTypeLookupTable.end()) ? std::string_view(result->first) : PluginProfiler::DefaultCallSite;
+}
+
+bool HookFilter::Matches(const HookEventInfo& info) const
+{
+    if (!ActionTypes.empty() || !CustomActionIds.empty())
+    {
+        if (!info.ActionType)
+            return false;
+
+        if (*info.ActionType == GameCommand::Custom)
+        {
+            if (std::find(CustomActionIds.begin(), CustomActionIds.end(), info.CustomActionId) == CustomActionIds.end())
+                return false;
+        }
+        else if (std::find(ActionTypes.begin(), ActionTypes.end(), *info.ActionType) == ActionTypes.end())
+        {
+            return false;
+        }
+    }
+    if (Player && info.Player != Player)
+        return false;
+    if (Range)
+    {
+        if (!info.Location)
+            return false;
+
+        const auto& loc = *info.Location;
+        if (loc.x < Range->GetLeft() || loc.x > Range->GetRight() || loc.y < Range->GetTop()
+            || loc.y > Range->GetBottom())
+            return false;
+    }
+    if (RideId && info.RideId != RideId)
+        return false;
+    return true;
 }
 
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
@@ -46,11 +89,12 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+uint32_t HookEngine::Subscribe(
+    HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter&& filter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, std::move(filter));
     return cookie;
 }
 
@@ -93,8 +137,16 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
     return !hookList.Hooks.empty();
 }
 
+bool HookEngine::HasSubscriptions(HOOK_TYPE type, const HookEventInfo& info) const
+{
+    auto& hookList = GetHookList(type);
+    return std::any_of(
+        hookList.Hooks.begin(), hookList.Hooks.end(), [&info](const Hook& hook) { return hook.Filter.Matches(info); });
+}
+
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
+    PluginProfiler::CallSiteScope callSiteScope(_scriptEngine.GetProfiler(), GetHookName(type));
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
@@ -104,6 +156,7 @@ void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
+    PluginProfiler::CallSiteScope callSiteScope(_scriptEngine.GetProfiler(), GetHookName(type));
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
@@ -111,9 +164,23 @@ void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutab
     }
 }
 
+void HookEngine::Call(HOOK_TYPE type, const HookEventInfo& info, const DukValue& arg, bool isGameStateMutable)
+{
+    PluginProfiler::CallSiteScope callSiteScope(_scriptEngine.GetProfiler(), GetHookName(type));
+    auto& hookList = GetHookList(type);
+    for (auto& hook : hookList.Hooks)
+    {
+        if (hook.Filter.Matches(info))
+        {
+            _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        }
+    }
+}
+
 void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
+    PluginProfiler::CallSiteScope callSiteScope(_scriptEngine.GetProfiler(), GetHookName(type));
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
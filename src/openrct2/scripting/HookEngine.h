@@ -11,11 +11,15 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../Game.h"
 #    include "../common.h"
+#    include "../ride/RideTypes.h"
+#    include "../world/Location.hpp"
 #    include "Duktape.hpp"
 
 #    include <any>
 #    include <memory>
+#    include <optional>
 #    include <string>
 #    include <tuple>
 #    include <vector>
@@ -44,18 +48,49 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
+
+    /**
+     * What is known about an event before its arguments are created. Used to skip hooks whose filter does not match
+     * without calling into the script engine.
+     */
+    struct HookEventInfo
+    {
+        std::optional<GameCommand> ActionType;
+        std::string_view CustomActionId;
+        std::optional<int32_t> Player;
+        std::optional<CoordsXY> Location;
+        std::optional<ride_id_t> RideId;
+    };
+
+    /**
+     * Restricts a hook to matching events. An event only matches a criterion when it carries that information,
+     * e.g. a hook with a range is not called for actions without a location.
+     */
+    struct HookFilter
+    {
+        std::vector<GameCommand> ActionTypes;
+        std::vector<std::string> CustomActionIds;
+        std::optional<int32_t> Player;
+        std::optional<MapRange> Range;
+        std::optional<ride_id_t> RideId;
+
+        bool Matches(const HookEventInfo& info) const;
+    };
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        HookFilter Filter;
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter&& filter)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Filter(std::move(filter))
         {
         }
     };
@@ -80,13 +115,16 @@ namespace OpenRCT2::Scripting
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function);
+        uint32_t Subscribe(
+            HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, HookFilter&& filter = {});
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
         bool HasSubscriptions(HOOK_TYPE type) const;
+        bool HasSubscriptions(HOOK_TYPE type, const HookEventInfo& info) const;
         void Call(HOOK_TYPE type, bool isGameStateMutable);
         void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        void Call(HOOK_TYPE type, const HookEventInfo& info, const DukValue& arg, bool isGameStateMutable);
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
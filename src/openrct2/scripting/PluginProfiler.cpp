@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "PluginProfiler.h"
+
+#    include "../core/Json.hpp"
+#    include "../core/String.hpp"
+#    include "Plugin.h"
+
+#    include <algorithm>
+
+using namespace OpenRCT2::Scripting;
+
+using namespace std::chrono;
+
+void PluginProfiler::BeginCall()
+{
+    _nestedCalls.emplace_back();
+}
+
+void PluginProfiler::EndCall(const Plugin* plugin, nanoseconds time, uint64_t allocations, uint64_t allocatedBytes)
+{
+    if (_nestedCalls.empty())
+        return;
+
+    auto nested = _nestedCalls.back();
+    _nestedCalls.pop_back();
+    if (!_nestedCalls.empty())
+    {
+        auto& parent = _nestedCalls.back();
+        parent.Time += time;
+        parent.Allocations += allocations;
+        parent.AllocatedBytes += allocatedBytes;
+    }
+
+    if (plugin != nullptr)
+    {
+        Record(*plugin, time - nested.Time, allocations - nested.Allocations, allocatedBytes - nested.AllocatedBytes);
+    }
+}
+
+void PluginProfiler::Record(const Plugin& plugin, nanoseconds time, uint64_t allocations, uint64_t allocatedBytes)
+{
+    const auto& pluginName = plugin.GetMetadata().Name;
+    auto it = _plugins.find(pluginName);
+    if (it == _plugins.end())
+    {
+        it = _plugins.emplace(pluginName, PluginStats()).first;
+    }
+    auto& pluginStats = it->second;
+    pluginStats.TickTime += time;
+
+    auto siteIt = pluginStats.CallSites.find(_callSite);
+    if (siteIt == pluginStats.CallSites.end())
+    {
+        siteIt = pluginStats.CallSites.emplace(std::string(_callSite), PluginCallStats()).first;
+    }
+    auto& callStats = siteIt->second;
+    callStats.Calls++;
+    callStats.TotalTime += time;
+    callStats.MaxTime = std::max(callStats.MaxTime, time);
+    callStats.Allocations += allocations;
+    callStats.AllocatedBytes += allocatedBytes;
+}
+
+void PluginProfiler::Reset()
+{
+    _plugins.clear();
+}
+
+void PluginProfiler::SetTickBudget(milliseconds budget)
+{
+    _tickBudget = budget;
+}
+
+bool PluginProfiler::IsOverBudget(const Plugin& plugin) const
+{
+    if (_tickBudget.count() <= 0)
+        return false;
+
+    auto it = _plugins.find(plugin.GetMetadata().Name);
+    return it != _plugins.end() && it->second.TickTime > _tickBudget;
+}
+
+std::vector<std::pair<std::string, nanoseconds>> PluginProfiler::EndTick(uint32_t timestamp)
+{
+    std::vector<std::pair<std::string, nanoseconds>> result;
+    for (auto& [pluginName, pluginStats] : _plugins)
+    {
+        if (_tickBudget.count() > 0 && pluginStats.TickTime > _tickBudget)
+        {
+            if (!pluginStats.HasWarned || timestamp - pluginStats.LastWarningTimestamp >= BudgetWarningInterval)
+            {
+                result.emplace_back(pluginName, pluginStats.TickTime);
+                pluginStats.LastWarningTimestamp = timestamp;
+                pluginStats.HasWarned = true;
+            }
+        }
+        pluginStats.TickTime = {};
+    }
+    return result;
+}
+
+std::vector<std::string> PluginProfiler::GetReport() const
+{
+    std::vector<std::string> result;
+    for (const auto& [pluginName, pluginStats] : _plugins)
+    {
+        result.push_back(pluginName + ":");
+        for (const auto& [callSite, callStats] : pluginStats.CallSites)
+        {
+            auto totalTime = duration_cast<microseconds>(callStats.TotalTime).count();
+            auto maxTime = duration_cast<microseconds>(callStats.MaxTime).count();
+            auto averageTime = callStats.Calls != 0 ? totalTime / static_cast<int64_t>(callStats.Calls) : 0;
+            result.push_back(String::StdFormat(
+                "  %s: %llu calls, %lld us total, %lld us average, %lld us max, %llu allocations, %llu KiB allocated",
+                callSite.c_str(), static_cast<unsigned long long>(callStats.Calls), static_cast<long long>(totalTime),
+                static_cast<long long>(averageTime), static_cast<long long>(maxTime),
+                static_cast<unsigned long long>(callStats.Allocations),
+                static_cast<unsigned long long>(callStats.AllocatedBytes / 1024)));
+        }
+    }
+    return result;
+}
+
+void PluginProfiler::SaveJson(const utf8* path) const
+{
+    json_t jsonPlugins = json_t::array();
+    for (const auto& [pluginName, pluginStats] : _plugins)
+    {
+        json_t jsonCallSites = json_t::object();
+        for (const auto& [callSite, callStats] : pluginStats.CallSites)
+        {
+            jsonCallSites[callSite] = {
+                { "calls", callStats.Calls },
+                { "totalTimeUs", duration_cast<microseconds>(callStats.TotalTime).count() },
+                { "maxTimeUs", duration_cast<microseconds>(callStats.MaxTime).count() },
+                { "allocations", callStats.Allocations },
+                { "allocatedBytes", callStats.AllocatedBytes },
+            };
+        }
+        jsonPlugins.push_back({ { "name", pluginName }, { "callSites", jsonCallSites } });
+    }
+
+    json_t jsonRoot = { { "tickBudgetMs", _tickBudget.count() }, { "plugins", jsonPlugins } };
+    Json::WriteToFile(path, jsonRoot);
+}
+
+#endif
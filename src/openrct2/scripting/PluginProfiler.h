@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2020 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../common.h"
+
+#    include <chrono>
+#    include <map>
+#    include <string>
+#    include <string_view>
+#    include <utility>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    class Plugin;
+
+    struct PluginCallStats
+    {
+        uint64_t Calls{};
+        std::chrono::nanoseconds TotalTime{};
+        std::chrono::nanoseconds MaxTime{};
+        uint64_t Allocations{};
+        uint64_t AllocatedBytes{};
+    };
+
+    /**
+     * Measures the time spent and memory allocated by each plugin, split by what triggered the call. Plugin calls
+     * nested within another, such as hooks run for a game action a plugin executed, are only counted for the nested
+     * call and are taken off the call they ran in.
+     */
+    class PluginProfiler
+    {
+    public:
+        static constexpr std::string_view DefaultCallSite = "other";
+
+        /**
+         * Attributes all plugin calls made within the scope to the given call site.
+         */
+        class CallSiteScope
+        {
+        private:
+            PluginProfiler& _profiler;
+            std::string_view _previousCallSite;
+
+        public:
+            CallSiteScope(PluginProfiler& profiler, std::string_view callSite)
+                : _profiler(profiler)
+                , _previousCallSite(profiler._callSite)
+            {
+                _profiler._callSite = callSite;
+            }
+            CallSiteScope(const CallSiteScope&) = delete;
+            ~CallSiteScope()
+            {
+                _profiler._callSite = _previousCallSite;
+            }
+        };
+
+    private:
+        static constexpr uint32_t BudgetWarningInterval = 5000;
+
+        struct PluginStats
+        {
+            std::map<std::string, PluginCallStats, std::less<>> CallSites;
+            std::chrono::nanoseconds TickTime{};
+            uint32_t LastWarningTimestamp{};
+            bool HasWarned{};
+        };
+
+        struct NestedCallTotals
+        {
+            std::chrono::nanoseconds Time{};
+            uint64_t Allocations{};
+            uint64_t AllocatedBytes{};
+        };
+
+        // Keyed by plugin name so that the counters survive plugins being reloaded
+        std::map<std::string, PluginStats, std::less<>> _plugins;
+        // One entry per plugin call in progress, holding what the calls nested within it have used
+        std::vector<NestedCallTotals> _nestedCalls;
+        std::string_view _callSite = DefaultCallSite;
+        std::chrono::milliseconds _tickBudget{};
+
+    public:
+        /**
+         * Brackets a single plugin call, the measurements given to EndCall include any calls nested within it.
+         */
+        void BeginCall();
+        void EndCall(const Plugin* plugin, std::chrono::nanoseconds time, uint64_t allocations, uint64_t allocatedBytes);
+        void Reset();
+
+        void SetTickBudget(std::chrono::milliseconds budget);
+        bool IsOverBudget(const Plugin& plugin) const;
+
+        /**
+         * Starts a new tick, returns the plugins that went over budget during the last one and are due a warning.
+         */
+        std::vector<std::pair<std::string, std::chrono::nanoseconds>> EndTick(uint32_t timestamp);
+
+        std::vector<std::string> GetReport() const;
+        void SaveJson(const utf8* path) const;
+
+    private:
+        void Record(const Plugin& plugin, std::chrono::nanoseconds time, uint64_t allocations, uint64_t allocatedBytes);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../actions/BatchAction.h"
 #    include "../actions/GameAction.h"
 #    include "../interface/Screenshot.h"
 #    include "../localisation/Formatting.h"
@@ -204,7 +205,8 @@ namespace OpenRCT2::Scripting
             return 1;
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        std::shared_ptr<ScDisposable> subscribe(
+            const std::string& hook, const DukValue& callback, const DukValue& filter)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
@@ -226,10 +228,83 @@ namespace OpenRCT2::Scripting
                 duk_error(ctx, DUK_ERR_ERROR, "Not in a plugin context");
             }
 
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, GetHookFilter(hookType, filter));
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
+        HookFilter GetHookFilter(HOOK_TYPE hookType, const DukValue& dukFilter)
+        {
+            HookFilter filter;
+            if (dukFilter.type() != DukValue::Type::OBJECT)
+            {
+                return filter;
+            }
+
+            auto ctx = dukFilter.context();
+            auto isActionHook = hookType == HOOK_TYPE::ACTION_QUERY || hookType == HOOK_TYPE::ACTION_EXECUTE
+                || hookType == HOOK_TYPE::ACTION_LOCATION;
+            auto isRideHook = hookType == HOOK_TYPE::RIDE_RATINGS_CALCULATE;
+
+            auto dukActions = dukFilter["actions"];
+            if (dukActions.type() != DukValue::Type::UNDEFINED)
+            {
+                if (!isActionHook || !dukActions.is_array())
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid actions filter.");
+                }
+                for (const auto& dukAction : dukActions.as_array())
+                {
+                    if (dukAction.type() != DukValue::Type::STRING)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Invalid actions filter.");
+                    }
+
+                    // Names that are not built-in actions refer to custom actions
+                    auto actionName = dukAction.as_string();
+                    auto actionType = ScriptEngine::GetGameActionType(actionName);
+                    if (actionType)
+                    {
+                        filter.ActionTypes.push_back(*actionType);
+                    }
+                    else
+                    {
+                        filter.CustomActionIds.push_back(actionName);
+                    }
+                }
+            }
+
+            auto dukPlayer = dukFilter["player"];
+            if (dukPlayer.type() != DukValue::Type::UNDEFINED)
+            {
+                if (!isActionHook || dukPlayer.type() != DukValue::Type::NUMBER)
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid player filter.");
+                }
+                filter.Player = dukPlayer.as_int();
+            }
+
+            auto dukRange = dukFilter["range"];
+            if (dukRange.type() != DukValue::Type::UNDEFINED)
+            {
+                if (!isActionHook || dukRange.type() != DukValue::Type::OBJECT)
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid range filter.");
+                }
+                filter.Range = FromDuk<MapRange>(dukRange);
+            }
+
+            auto dukRideId = dukFilter["rideId"];
+            if (dukRideId.type() != DukValue::Type::UNDEFINED)
+            {
+                if (!isRideHook || dukRideId.type() != DukValue::Type::NUMBER)
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Invalid ride filter.");
+                }
+                filter.RideId = static_cast<ride_id_t>(dukRideId.as_int());
+            }
+            return filter;
+        }
+
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
         {
             QueryOrExecuteAction(action, args, callback, false);
@@ -275,6 +350,62 @@ namespace OpenRCT2::Scripting
             }
         }
 
+        void queryActions(const DukValue& actions, const DukValue& callback)
+        {
+            QueryOrExecuteActions(actions, callback, false);
+        }
+
+        void executeActions(const DukValue& actions, const DukValue& callback)
+        {
+            QueryOrExecuteActions(actions, callback, true);
+        }
+
+        void QueryOrExecuteActions(const DukValue& actions, const DukValue& callback, bool isExecute)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            if (!actions.is_array())
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid actions.");
+            }
+
+            try
+            {
+                BatchAction batchAction;
+                for (const auto& item : actions.as_array())
+                {
+                    auto action = scriptEngine.CreateGameAction(AsOrDefault(item["action"], ""), item["args"]);
+                    if (action == nullptr)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Unknown action.");
+                    }
+                    if (!batchAction.Add(std::move(action)))
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Action can not be batched or too many actions.");
+                    }
+                }
+
+                auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+                if (isExecute)
+                {
+                    batchAction.SetCallback(
+                        [this, plugin, callback](const GameAction*, const GameActions::Result* res) -> void {
+                            HandleGameActionResult(plugin, *res, callback);
+                        });
+                    GameActions::Execute(&batchAction);
+                }
+                else
+                {
+                    auto res = GameActions::Query(&batchAction);
+                    HandleGameActionResult(plugin, *res, callback);
+                }
+            }
+            catch (DukException&)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid action parameters.");
+            }
+        }
+
         void HandleGameActionResult(
             const std::shared_ptr<Plugin>& plugin, const GameActions::Result& res, const DukValue& callback)
         {
@@ -389,6 +520,8 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
             dukglue_register_method(ctx, &ScContext::queryAction, "queryAction");
             dukglue_register_method(ctx, &ScContext::executeAction, "executeAction");
+            dukglue_register_method(ctx, &ScContext::queryActions, "queryActions");
+            dukglue_register_method(ctx, &ScContext::executeActions, "executeActions");
             dukglue_register_method(ctx, &ScContext::registerAction, "registerAction");
             dukglue_register_method(ctx, &ScContext::setInterval, "setInterval");
             dukglue_register_method(ctx, &ScContext::setTimeout, "setTimeout");
@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../actions/TileRegionSetAction.h"
 #    include "../common.h"
 #    include "../ride/Ride.h"
 #    include "../ride/TrainManager.h"
@@ -23,6 +24,12 @@
 #    include "ScRide.hpp"
 #    include "ScTile.hpp"
 
+#    include <algorithm>
+#    include <cstring>
+#    include <memory>
+#    include <optional>
+#    include <vector>
+
 namespace OpenRCT2::Scripting
 {
     class ScMap
@@ -155,6 +162,181 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        DukValue queryEntities(
+            const std::string& type, const std::vector<std::string>& fields, const DukValue& range) const
+        {
+            std::optional<MapRange> mapRange;
+            if (range.type() == DukValue::Type::OBJECT)
+            {
+                mapRange = FromDuk<MapRange>(range);
+            }
+
+            std::vector<const SpriteBase*> entities;
+            if (type == "balloon")
+            {
+                CollectEntities<Balloon>(entities, mapRange);
+            }
+            else if (type == "car")
+            {
+                CollectEntities<Vehicle>(entities, mapRange);
+            }
+            else if (type == "litter")
+            {
+                CollectEntities<Litter>(entities, mapRange);
+            }
+            else if (type == "duck")
+            {
+                CollectEntities<Duck>(entities, mapRange);
+            }
+            else if (type == "peep")
+            {
+                CollectEntities<Guest>(entities, mapRange);
+                CollectEntities<Staff>(entities, mapRange);
+            }
+            else
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+            }
+
+            DukObject result(_context);
+            result.Set("count", static_cast<int32_t>(entities.size()));
+            for (const auto& fieldName : fields)
+            {
+                auto field = std::find_if(
+                    std::begin(EntityDataFields), std::end(EntityDataFields),
+                    [&fieldName](const EntityDataField& f) { return fieldName == f.Name; });
+                if (field == std::end(EntityDataFields))
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid entity field.");
+                }
+                result.Set(field->Name, CreateEntityDataArray(*field, entities));
+            }
+            return result.Take();
+        }
+
+        DukValue getTileData(const DukValue& range) const
+        {
+            auto tileRange = GetTileRange(range);
+
+            std::vector<uint16_t> counts;
+            size_t numElements = 0;
+            for (int32_t y = tileRange.GetTop(); y <= tileRange.GetBottom(); y += COORDS_XY_STEP)
+            {
+                for (int32_t x = tileRange.GetLeft(); x <= tileRange.GetRight(); x += COORDS_XY_STEP)
+                {
+                    auto count = GetNumElementsOnTile({ x, y });
+                    counts.push_back(static_cast<uint16_t>(count));
+                    numElements += count;
+                }
+            }
+
+            DukObject result(_context);
+            auto countsLen = counts.size() * sizeof(uint16_t);
+            auto countsData = duk_push_fixed_buffer(_context, countsLen);
+            std::memcpy(countsData, counts.data(), countsLen);
+            duk_push_buffer_object(_context, -1, 0, countsLen, DUK_BUFOBJ_UINT16ARRAY);
+            duk_remove(_context, -2);
+            result.Set("counts", DukValue::take_from_stack(_context));
+
+            // Tiles are stored one after the other, so the whole region is copied in a single pass.
+            auto dataLen = numElements * sizeof(TileElement);
+            auto data = static_cast<uint8_t*>(duk_push_fixed_buffer(_context, dataLen));
+            for (int32_t y = tileRange.GetTop(); y <= tileRange.GetBottom(); y += COORDS_XY_STEP)
+            {
+                for (int32_t x = tileRange.GetLeft(); x <= tileRange.GetRight(); x += COORDS_XY_STEP)
+                {
+                    const auto* first = map_get_first_element_at({ x, y });
+                    auto tileLen = GetNumElementsOnTile({ x, y }) * sizeof(TileElement);
+                    if (tileLen != 0)
+                    {
+                        std::memcpy(data, first, tileLen);
+                        data += tileLen;
+                    }
+                }
+            }
+            duk_push_buffer_object(_context, -1, 0, dataLen, DUK_BUFOBJ_UINT8ARRAY);
+            duk_remove(_context, -2);
+            result.Set("data", DukValue::take_from_stack(_context));
+            return result.Take();
+        }
+
+        void setTileData(const DukValue& range, const DukValue& tileData)
+        {
+            auto tileRange = GetTileRange(range);
+            auto counts = GetBufferData(tileData["counts"]);
+            auto data = GetBufferData(tileData["data"]);
+
+            auto numTilesX = static_cast<size_t>((tileRange.GetRight() - tileRange.GetLeft()) / COORDS_XY_STEP + 1);
+            auto numTilesY = static_cast<size_t>((tileRange.GetBottom() - tileRange.GetTop()) / COORDS_XY_STEP + 1);
+            if (counts.size() != numTilesX * numTilesY * sizeof(uint16_t) || data.size() % sizeof(TileElement) != 0)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Tile data does not match range.");
+            }
+
+            // Check all the counts before any row is changed, so bad data never leaves a region half set.
+            auto numElements = data.size() / sizeof(TileElement);
+            size_t totalCount = 0;
+            for (size_t i = 0; i < numTilesX * numTilesY; i++)
+            {
+                uint16_t count{};
+                std::memcpy(&count, &counts[i * sizeof(uint16_t)], sizeof(count));
+                if (count > TileRegionSetAction::MaxElements)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Tile data does not match range.");
+                }
+                totalCount += count;
+            }
+            if (totalCount != numElements)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Tile data does not match range.");
+            }
+
+            // Regions are sent as one action per row, rows with too many elements for a single action are split.
+            std::vector<std::unique_ptr<TileRegionSetAction>> actions;
+            size_t tileIndex = 0;
+            size_t elementIndex = 0;
+            for (int32_t y = tileRange.GetTop(); y <= tileRange.GetBottom(); y += COORDS_XY_STEP)
+            {
+                auto left = tileRange.GetLeft();
+                std::vector<uint16_t> actionCounts;
+                std::vector<TileElement> actionElements;
+                for (int32_t x = tileRange.GetLeft(); x <= tileRange.GetRight(); x += COORDS_XY_STEP)
+                {
+                    uint16_t count{};
+                    std::memcpy(&count, &counts[tileIndex++ * sizeof(uint16_t)], sizeof(count));
+                    if (actionElements.size() + count > TileRegionSetAction::MaxElements)
+                    {
+                        AddTileRegionSet(actions, { left, y, x - COORDS_XY_STEP, y }, actionCounts, actionElements);
+                        left = x;
+                    }
+
+                    actionCounts.push_back(count);
+                    auto* first = reinterpret_cast<const TileElement*>(&data[elementIndex * sizeof(TileElement)]);
+                    actionElements.insert(actionElements.end(), first, first + count);
+                    elementIndex += count;
+                }
+                AddTileRegionSet(actions, { left, y, tileRange.GetRight(), y }, actionCounts, actionElements);
+            }
+
+            // Every tile has to pass the surface, location and capacity checks before any row is changed.
+            for (const auto& action : actions)
+            {
+                auto res = GameActions::Query(action.get());
+                if (res->Error != GameActions::Status::Ok)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Unable to set tile data.");
+                }
+            }
+            for (const auto& action : actions)
+            {
+                auto res = GameActions::Execute(action.get());
+                if (res->Error != GameActions::Status::Ok)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Unable to set tile data.");
+                }
+            }
+        }
+
         static void Register(duk_context* ctx)
         {
             dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
@@ -165,9 +347,226 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScMap::getTile, "getTile");
             dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
             dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
+            dukglue_register_method(ctx, &ScMap::getTileData, "getTileData");
+            dukglue_register_method(ctx, &ScMap::setTileData, "setTileData");
         }
 
     private:
+        MapRange GetTileRange(const DukValue& range) const
+        {
+            auto mapRange = FromDuk<MapRange>(range);
+            auto leftTop = mapRange.Point1.ToTileStart();
+            auto rightBottom = mapRange.Point2.ToTileStart();
+            if (!map_is_location_valid(leftTop) || !map_is_location_valid(rightBottom))
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid range.");
+            }
+            return MapRange(leftTop, rightBottom);
+        }
+
+        static size_t GetNumElementsOnTile(const CoordsXY& loc)
+        {
+            const auto* element = map_get_first_element_at(loc);
+            size_t count = 0;
+            if (element != nullptr)
+            {
+                do
+                {
+                    count++;
+                } while (!(element++)->IsLastForTile());
+            }
+            return count;
+        }
+
+        std::vector<uint8_t> GetBufferData(const DukValue& value) const
+        {
+            std::vector<uint8_t> result;
+            value.push();
+            if (duk_is_buffer_data(_context, -1))
+            {
+                duk_size_t len{};
+                auto* data = static_cast<const uint8_t*>(duk_get_buffer_data(_context, -1, &len));
+                result.assign(data, data + len);
+            }
+            duk_pop(_context);
+            return result;
+        }
+
+        static void AddTileRegionSet(
+            std::vector<std::unique_ptr<TileRegionSetAction>>& actions, const MapRange& range, std::vector<uint16_t>& counts,
+            std::vector<TileElement>& elements)
+        {
+            if (counts.empty())
+                return;
+
+            actions.push_back(std::make_unique<TileRegionSetAction>(range, std::move(counts), std::move(elements)));
+            counts.clear();
+            elements.clear();
+        }
+
+        enum class EntityDataFieldId : uint8_t
+        {
+            Id,
+            X,
+            Y,
+            Z,
+            State,
+            Energy,
+            Happiness,
+            Nausea,
+            Hunger,
+            Thirst,
+            Toilet,
+            Cash,
+        };
+
+        struct EntityDataField
+        {
+            const char* Name;
+            EntityDataFieldId Id;
+            duk_uint_t ArrayType;
+        };
+
+        static constexpr EntityDataField EntityDataFields[] = {
+            { "id", EntityDataFieldId::Id, DUK_BUFOBJ_UINT16ARRAY },
+            { "x", EntityDataFieldId::X, DUK_BUFOBJ_INT32ARRAY },
+            { "y", EntityDataFieldId::Y, DUK_BUFOBJ_INT32ARRAY },
+            { "z", EntityDataFieldId::Z, DUK_BUFOBJ_INT32ARRAY },
+            { "state", EntityDataFieldId::State, DUK_BUFOBJ_UINT8ARRAY },
+            { "energy", EntityDataFieldId::Energy, DUK_BUFOBJ_UINT8ARRAY },
+            { "happiness", EntityDataFieldId::Happiness, DUK_BUFOBJ_UINT8ARRAY },
+            { "nausea", EntityDataFieldId::Nausea, DUK_BUFOBJ_UINT8ARRAY },
+            { "hunger", EntityDataFieldId::Hunger, DUK_BUFOBJ_UINT8ARRAY },
+            { "thirst", EntityDataFieldId::Thirst, DUK_BUFOBJ_UINT8ARRAY },
+            { "toilet", EntityDataFieldId::Toilet, DUK_BUFOBJ_UINT8ARRAY },
+            { "cash", EntityDataFieldId::Cash, DUK_BUFOBJ_INT32ARRAY },
+        };
+
+        static int32_t GetEntityDataValue(const SpriteBase& entity, EntityDataFieldId id)
+        {
+            switch (id)
+            {
+                case EntityDataFieldId::Id:
+                    return entity.sprite_index;
+                case EntityDataFieldId::X:
+                    return entity.x;
+                case EntityDataFieldId::Y:
+                    return entity.y;
+                case EntityDataFieldId::Z:
+                    return entity.z;
+                default:
+                    break;
+            }
+
+            // The remaining fields are zero for entities that do not have them
+            auto peep = entity.As<Peep>();
+            if (peep == nullptr)
+                return 0;
+
+            switch (id)
+            {
+                case EntityDataFieldId::State:
+                    return EnumValue(peep->State);
+                case EntityDataFieldId::Energy:
+                    return peep->Energy;
+                default:
+                    break;
+            }
+
+            auto guest = entity.As<Guest>();
+            if (guest == nullptr)
+                return 0;
+
+            switch (id)
+            {
+                case EntityDataFieldId::Happiness:
+                    return guest->Happiness;
+                case EntityDataFieldId::Nausea:
+                    return guest->Nausea;
+                case EntityDataFieldId::Hunger:
+                    return guest->Hunger;
+                case EntityDataFieldId::Thirst:
+                    return guest->Thirst;
+                case EntityDataFieldId::Toilet:
+                    return guest->Toilet;
+                case EntityDataFieldId::Cash:
+                    return guest->CashInPocket;
+                default:
+                    return 0;
+            }
+        }
+
+        template<typename T>
+        static void CollectEntities(std::vector<const SpriteBase*>& entities, const std::optional<MapRange>& range)
+        {
+            if (!range)
+            {
+                for (auto entity : EntityList<T>())
+                {
+                    entities.push_back(entity);
+                }
+                return;
+            }
+
+            // Walk the spatial index of the tiles in range rather than every entity of the type
+            auto maxXY = (gMapSize - 1) * COORDS_XY_STEP;
+            auto left = std::clamp(range->GetLeft(), 0, maxXY) & ~(COORDS_XY_STEP - 1);
+            auto top = std::clamp(range->GetTop(), 0, maxXY) & ~(COORDS_XY_STEP - 1);
+            auto right = std::clamp(range->GetRight(), 0, maxXY);
+            auto bottom = std::clamp(range->GetBottom(), 0, maxXY);
+            for (int32_t y = top; y <= bottom; y += COORDS_XY_STEP)
+            {
+                for (int32_t x = left; x <= right; x += COORDS_XY_STEP)
+                {
+                    for (auto entity : EntityTileList<T>({ x, y }))
+                    {
+                        entities.push_back(entity);
+                    }
+                }
+            }
+        }
+
+        template<typename T>
+        static void FillEntityData(
+            void* buffer, const EntityDataField& field, const std::vector<const SpriteBase*>& entities)
+        {
+            auto data = static_cast<T*>(buffer);
+            for (size_t i = 0; i < entities.size(); i++)
+            {
+                data[i] = static_cast<T>(GetEntityDataValue(*entities[i], field.Id));
+            }
+        }
+
+        DukValue CreateEntityDataArray(
+            const EntityDataField& field, const std::vector<const SpriteBase*>& entities) const
+        {
+            size_t elementSize = sizeof(int32_t);
+            if (field.ArrayType == DUK_BUFOBJ_UINT8ARRAY)
+                elementSize = sizeof(uint8_t);
+            else if (field.ArrayType == DUK_BUFOBJ_UINT16ARRAY)
+                elementSize = sizeof(uint16_t);
+
+            // Fill the array's backing buffer directly, no intermediate JS values are created
+            auto dataLen = entities.size() * elementSize;
+            auto data = duk_push_fixed_buffer(_context, dataLen);
+            switch (field.ArrayType)
+            {
+                case DUK_BUFOBJ_UINT8ARRAY:
+                    FillEntityData<uint8_t>(data, field, entities);
+                    break;
+                case DUK_BUFOBJ_UINT16ARRAY:
+                    FillEntityData<uint16_t>(data, field, entities);
+                    break;
+                default:
+                    FillEntityData<int32_t>(data, field, entities);
+                    break;
+            }
+            duk_push_buffer_object(_context, -1, 0, dataLen, field.ArrayType);
+            duk_remove(_context, -2);
+            return DukValue::take_from_stack(_context);
+        }
+
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
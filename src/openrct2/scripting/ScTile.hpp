@@ -1652,33 +1652,11 @@ namespace OpenRCT2::Scripting
                 }
                 else
                 {
-                    auto first = GetFirstElement();
-                    auto currentNumElements = GetNumElements(first);
-                    if (numElements > currentNumElements)
+                    std::vector<TileElement> elements(numElements);
+                    std::memcpy(elements.data(), data, numElements * sizeof(TileElement));
+                    if (!map_replace_tile_elements(TileCoordsXY(_coords), elements.data(), numElements))
                     {
-                        // Allocate space for the extra tile elements (inefficient but works)
-                        auto pos = TileCoordsXYZ(TileCoordsXY(_coords), 0).ToCoordsXYZ();
-                        auto numToInsert = numElements - currentNumElements;
-                        for (size_t i = 0; i < numToInsert; i++)
-                        {
-                            tile_element_insert(pos, 0, TileElementType::Surface);
-                        }
-
-                        // Copy data to element span
-                        first = map_get_first_element_at(_coords);
-                        currentNumElements = GetNumElements(first);
-                        if (currentNumElements != 0)
-                        {
-                            std::memcpy(first, data, currentNumElements * sizeof(TileElement));
-                            // Safely force last tile flag for last element to avoid read overrun
-                            first[numElements - 1].SetLastForTile(true);
-                        }
-                    }
-                    else
-                    {
-                        std::memcpy(first, data, numElements * sizeof(TileElement));
-                        // Safely force last tile flag for last element to avoid read overrun
-                        first[numElements - 1].SetLastForTile(true);
+                        duk_error(ctx, DUK_ERR_ERROR, "Unable to allocate element.");
                     }
                 }
                 map_invalidate_tile_full(_coords);
@@ -20,6 +20,7 @@
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
 #    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform2.h"
 #    include "Duktape.hpp"
@@ -39,6 +40,8 @@
 #    include "ScSocket.hpp"
 #    include "ScTile.hpp"
 
+#    include <chrono>
+#    include <cstdlib>
 #    include <iostream>
 #    include <stdexcept>
 
@@ -353,9 +356,32 @@ public:
     }
 };
 
+static void* DukAlloc(void* udata, duk_size_t size)
+{
+    auto stats = static_cast<DukAllocationStats*>(udata);
+    stats->Allocations++;
+    stats->AllocatedBytes += size;
+    return std::malloc(size);
+}
+
+static void* DukRealloc(void* udata, void* ptr, duk_size_t size)
+{
+    auto stats = static_cast<DukAllocationStats*>(udata);
+    stats->Allocations++;
+    stats->AllocatedBytes += size;
+    return std::realloc(ptr, size);
+}
+
+static void DukFree(void*, void* ptr)
+{
+    std::free(ptr);
+}
+
 DukContext::DukContext()
+    : _allocationStats(std::make_unique<DukAllocationStats>())
 {
-    _context = duk_create_heap_default();
+    // Allocations are counted so that they can be attributed to the plugin that was running at the time
+    _context = duk_create_heap(DukAlloc, DukRealloc, DukFree, _allocationStats.get(), nullptr);
     if (_context == nullptr)
     {
         throw std::runtime_error("Unable to initialise duktape context.");
@@ -663,6 +689,7 @@ void ScriptEngine::Update()
     UpdateIntervals();
     UpdateSockets();
     ProcessREPL();
+    UpdateTickBudget();
 }
 
 void ScriptEngine::ProcessREPL()
@@ -719,7 +746,16 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
+
+        auto startAllocationStats = _context.GetAllocationStats();
+        auto startTime = std::chrono::high_resolution_clock::now();
+        _profiler.BeginCall();
         auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        const auto& allocationStats = _context.GetAllocationStats();
+        _profiler.EndCall(
+            plugin.get(), std::chrono::high_resolution_clock::now() - startTime,
+            allocationStats.Allocations - startAllocationStats.Allocations,
+            allocationStats.AllocatedBytes - startAllocationStats.AllocatedBytes);
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -776,6 +812,8 @@ std::unique_ptr<GameActions::Result> ScriptEngine::QueryOrExecuteCustomGameActio
         }
 
         // Ready to call plugin handler
+        auto callSite = isExecute ? "action.custom.execute" : "action.custom.query";
+        PluginProfiler::CallSiteScope callSiteScope(_profiler, callSite);
         DukValue dukResult;
         if (!isExecute)
         {
@@ -1056,6 +1094,7 @@ const static std::unordered_map<std::string, GameCommand> ActionNameToType = {
     { "staffsetpatrolarea", GameCommand::SetStaffPatrol },
     { "surfacesetstyle", GameCommand::ChangeSurfaceStyle },
     { "tilemodify", GameCommand::ModifyTile },
+    { "tileregionset", GameCommand::SetTileRegion },
     { "trackdesign", GameCommand::PlaceTrackDesign },
     { "trackplace", GameCommand::PlaceTrack },
     { "trackremove", GameCommand::RemoveTrack },
@@ -1094,7 +1133,23 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<
     DukStackFrame frame(_context);
 
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+
+    std::string customActionId;
+    if (action.GetType() == GameCommand::Custom)
+    {
+        customActionId = static_cast<const CustomAction&>(action).GetId();
+    }
+
+    HookEventInfo info;
+    info.ActionType = action.GetType();
+    info.CustomActionId = customActionId;
+    info.Player = action.GetPlayer();
+    if (!result->Position.isNull())
+    {
+        info.Location = result->Position;
+    }
+
+    if (_hookEngine.HasSubscriptions(hookType, info))
     {
         DukObject obj(_context);
 
@@ -1139,7 +1194,7 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, std::unique_ptr<
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
+        _hookEngine.Call(hookType, info, dukEventArgs, false);
 
         if (!isExecute)
         {
@@ -1191,6 +1246,16 @@ std::unique_ptr<GameAction> ScriptEngine::CreateGameAction(const std::string& ac
     }
 }
 
+std::optional<GameCommand> ScriptEngine::GetGameActionType(const std::string& actionid)
+{
+    auto result = ActionNameToType.find(actionid);
+    if (result != ActionNameToType.end())
+    {
+        return result->second;
+    }
+    return std::nullopt;
+}
+
 void ScriptEngine::InitSharedStorage()
 {
     duk_push_object(_context);
@@ -1298,10 +1363,17 @@ void ScriptEngine::UpdateIntervals()
     }
     _lastIntervalTimestamp = timestamp;
 
+    PluginProfiler::CallSiteScope callSiteScope(_profiler, "interval");
     for (auto& interval : _intervals)
     {
         if (interval.IsValid())
         {
+            // Intervals can not modify the game state, so deferring them until the plugin is back within its
+            // budget is safe in multiplayer.
+            if (interval.Owner != nullptr && _profiler.IsOverBudget(*interval.Owner))
+            {
+                continue;
+            }
             if (timestamp >= interval.LastTimestamp + interval.Delay)
             {
                 ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
@@ -1316,6 +1388,18 @@ void ScriptEngine::UpdateIntervals()
     }
 }
 
+void ScriptEngine::UpdateTickBudget()
+{
+    _profiler.SetTickBudget(std::chrono::milliseconds(gConfigPlugin.tick_budget_ms));
+    for (const auto& [pluginName, tickTime] : _profiler.EndTick(platform_get_ticks()))
+    {
+        auto tickTimeMs = std::chrono::duration<double, std::milli>(tickTime).count();
+        _console.WriteLineWarning(String::StdFormat(
+            "[%s] Exceeded the tick budget: %.2f ms of %d ms", pluginName.c_str(), tickTimeMs,
+            gConfigPlugin.tick_budget_ms));
+    }
+}
+
 void ScriptEngine::RemoveIntervals(const std::shared_ptr<Plugin>& plugin)
 {
     for (auto& interval : _intervals)
@@ -17,11 +17,13 @@
 #    include "../world/Location.hpp"
 #    include "HookEngine.h"
 #    include "Plugin.h"
+#    include "PluginProfiler.h"
 
 #    include <future>
 #    include <list>
 #    include <memory>
 #    include <mutex>
+#    include <optional>
 #    include <queue>
 #    include <string>
 #    include <unordered_map>
@@ -46,7 +48,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 31;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 35;
 
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
@@ -98,16 +100,24 @@ namespace OpenRCT2::Scripting
         }
     };
 
+    struct DukAllocationStats
+    {
+        uint64_t Allocations{};
+        uint64_t AllocatedBytes{};
+    };
+
     class DukContext
     {
     private:
         duk_context* _context{};
+        std::unique_ptr<DukAllocationStats> _allocationStats;
 
     public:
         DukContext();
         DukContext(DukContext&) = delete;
         DukContext(DukContext&& src) noexcept
             : _context(std::move(src._context))
+            , _allocationStats(std::move(src._allocationStats))
         {
             src._context = {};
         }
@@ -117,6 +127,11 @@ namespace OpenRCT2::Scripting
         {
             return _context;
         }
+
+        const DukAllocationStats& GetAllocationStats() const
+        {
+            return *_allocationStats;
+        }
     };
 
     using IntervalHandle = int32_t;
@@ -148,6 +163,7 @@ namespace OpenRCT2::Scripting
         std::vector<std::shared_ptr<Plugin>> _plugins;
         uint32_t _lastHotReloadCheckTick{};
         HookEngine _hookEngine;
+        PluginProfiler _profiler;
         ScriptExecutionInfo _execInfo;
         DukValue _sharedStorage;
 
@@ -184,6 +200,10 @@ namespace OpenRCT2::Scripting
         {
             return _hookEngine;
         }
+        PluginProfiler& GetProfiler()
+        {
+            return _profiler;
+        }
         ScriptExecutionInfo& GetExecInfo()
         {
             return _execInfo;
@@ -223,6 +243,7 @@ namespace OpenRCT2::Scripting
             const std::shared_ptr<Plugin>& plugin, std::string_view action, const DukValue& query, const DukValue& execute);
         void RunGameActionHooks(const GameAction& action, std::unique_ptr<GameActions::Result>& result, bool isExecute);
         std::unique_ptr<GameAction> CreateGameAction(const std::string& actionid, const DukValue& args);
+        static std::optional<GameCommand> GetGameActionType(const std::string& actionid);
 
         void SaveSharedStorage();
 
@@ -256,6 +277,7 @@ namespace OpenRCT2::Scripting
 
         IntervalHandle AllocateHandle();
         void UpdateIntervals();
+        void UpdateTickBudget();
         void RemoveIntervals(const std::shared_ptr<Plugin>& plugin);
 
         void UpdateSockets();
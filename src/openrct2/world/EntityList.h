@@ -16,8 +16,11 @@
 #include "SpriteBase.h"
 
 #include <list>
+#include <type_traits>
 #include <vector>
 
+struct Vehicle;
+
 enum class EntityListId : uint8_t
 {
     Count = 6,
@@ -26,9 +29,22 @@ enum class EntityListId : uint8_t
 const std::list<uint16_t>& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
+// Changes whenever an entity of the given type is created or removed
+uint32_t GetEntityListGeneration(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<uint16_t>& GetEntityTileList(const CoordsXY& spritePos);
+const std::vector<uint16_t>& GetVehicleTileList(const CoordsXY& spritePos);
+
+// Vehicles are kept in their own spatial index so that per tile vehicle scans (e.g. collision detection)
+// do not have to step over every guest and misc entity on the tile. Both are kept in sprite_index order.
+template<typename T> const std::vector<uint16_t>& GetEntityTileListForType(const CoordsXY& spritePos)
+{
+    if constexpr (std::is_same_v<T, Vehicle>)
+        return GetVehicleTileList(spritePos);
+    else
+        return GetEntityTileList(spritePos);
+}
 
 template<typename T> class EntityTileIterator
 {
@@ -88,7 +104,7 @@ private:
 
 public:
     EntityTileList(const CoordsXY& loc)
-        : vec(GetEntityTileList(loc))
+        : vec(GetEntityTileListForType<T>(loc))
     {
     }
 
@@ -34,6 +34,7 @@
 #include "Park.h"
 #include "Sprite.h"
 #include "Surface.h"
+#include "TileElementsView.h"
 
 #include <algorithm>
 #include <iterator>
@@ -1552,6 +1553,9 @@ bool PathElement::IsBroken() const
 
 void PathElement::SetIsBroken(bool isBroken)
 {
+    if (isBroken != IsBroken())
+        MarkTileElementChanged(as<TileElement>());
+
     if (isBroken)
     {
         Flags2 |= FOOTPATH_ELEMENT_FLAGS2_ADDITION_IS_BROKEN;
@@ -1625,6 +1629,9 @@ PathBitEntry* PathElement::GetAdditionEntry() const
 
 void PathElement::SetAddition(uint8_t newAddition)
 {
+    if (newAddition != Additions)
+        MarkTileElementChanged(as<TileElement>());
+
     Additions = newAddition;
 }
 
@@ -1635,6 +1642,9 @@ bool PathElement::AdditionIsGhost() const
 
 void PathElement::SetAdditionIsGhost(bool isGhost)
 {
+    if (isGhost != AdditionIsGhost())
+        MarkTileElementChanged(as<TileElement>());
+
     Flags2 &= ~FOOTPATH_ELEMENT_FLAGS2_ADDITION_IS_GHOST;
     if (isGhost)
         Flags2 |= FOOTPATH_ELEMENT_FLAGS2_ADDITION_IS_GHOST;
@@ -1749,6 +1759,11 @@ void footpath_update_path_wide_flags(const CoordsXY& footpathPos)
     if (map_is_location_at_edge(footpathPos))
         return;
 
+    // Most tiles visited by the wide flag sweep have no path at all, in which case there is nothing to clear or set
+    auto pathElements = OpenRCT2::TileElementsView<PathElement>(footpathPos);
+    if (pathElements.begin() == pathElements.end())
+        return;
+
     footpath_clear_wide(footpathPos);
     /* Rather than clearing the wide flag of the following tiles and
      * checking the state of them later, leave them intact and assume
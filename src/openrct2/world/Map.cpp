@@ -59,6 +59,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 
@@ -118,14 +119,76 @@ static std::vector<TileElement> _tileElements;
 static TilePointerIndex<TileElement> _tileIndexStash;
 static std::vector<TileElement> _tileElementsStash;
 static size_t _tileElementsInUse;
+static uint32_t _tileElementsGeneration;
+static std::vector<TileCoordsXY> _changedTiles;
+static std::vector<size_t> _changedTileBlocks;
+static bool _allTilesChanged = true;
+// The tile each block of elements belongs to, keyed by the offset of the block's first element. Built when first
+// needed and kept up to date as tiles move, so changes to an element can be traced back to its tile.
+static std::unordered_map<size_t, TileCoordsXY> _tileBlockOwners;
+static bool _tileBlockOwnersValid;
 static size_t _tileElementsInUseStash;
 static int32_t _mapSizeUnitsStash;
 static int32_t _mapSizeMinus2Stash;
 static int32_t _mapSizeStash;
 static int32_t _currentRotationStash;
 
+// Past this many changes it is cheaper for a per tile cache to start over
+static constexpr size_t MaxChangedTiles = 4096;
+
+static void MarkAllTilesChanged()
+{
+    _tileElementsGeneration++;
+    _allTilesChanged = true;
+    _changedTiles.clear();
+    _changedTileBlocks.clear();
+    _tileBlockOwners.clear();
+    _tileBlockOwnersValid = false;
+}
+
+static void BuildTileBlockOwners()
+{
+    _tileBlockOwners.clear();
+    const auto* firstElement = _tileElements.data();
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            const auto* tileElement = _tileIndex.GetFirstElementAt(TileCoordsXY{ x, y });
+            if (tileElement != nullptr)
+            {
+                _tileBlockOwners[static_cast<size_t>(tileElement - firstElement)] = TileCoordsXY{ x, y };
+            }
+        }
+    }
+    _tileBlockOwnersValid = true;
+}
+
+static void SetTileBlock(const TileCoordsXY& tilePos, TileElement* elements)
+{
+    if (_tileBlockOwnersValid)
+    {
+        const auto* firstElement = _tileElements.data();
+        const auto* oldElements = _tileIndex.GetFirstElementAt(tilePos);
+        if (oldElements != nullptr)
+        {
+            _tileBlockOwners.erase(static_cast<size_t>(oldElements - firstElement));
+        }
+        if (elements >= firstElement && elements < firstElement + _tileElements.size())
+        {
+            _tileBlockOwners[static_cast<size_t>(elements - firstElement)] = tilePos;
+        }
+        else if (elements != nullptr)
+        {
+            _tileBlockOwnersValid = false;
+        }
+    }
+    _tileIndex.SetTile(tilePos, elements);
+}
+
 void StashMap()
 {
+    MarkAllTilesChanged();
     _tileIndexStash = std::move(_tileIndex);
     _tileElementsStash = std::move(_tileElements);
     _mapSizeUnitsStash = gMapSizeUnits;
@@ -137,6 +200,7 @@ void StashMap()
 
 void UnstashMap()
 {
+    MarkAllTilesChanged();
     _tileIndex = std::move(_tileIndexStash);
     _tileElements = std::move(_tileElementsStash);
     gMapSizeUnits = _mapSizeUnitsStash;
@@ -151,8 +215,81 @@ const std::vector<TileElement>& GetTileElements()
     return _tileElements;
 }
 
+uint32_t GetTileElementsGeneration()
+{
+    return _tileElementsGeneration;
+}
+
+void MarkTileElementsChanged(const TileCoordsXY& tilePos)
+{
+    _tileElementsGeneration++;
+    if (_allTilesChanged)
+        return;
+
+    if (_changedTiles.size() + _changedTileBlocks.size() >= MaxChangedTiles)
+    {
+        MarkAllTilesChanged();
+        return;
+    }
+    _changedTiles.push_back(tilePos);
+}
+
+void MarkTileElementChanged(const TileElement* tileElement)
+{
+    _tileElementsGeneration++;
+    if (_allTilesChanged)
+        return;
+
+    const auto* firstElement = _tileElements.data();
+    if (tileElement < firstElement || tileElement >= firstElement + _tileElements.size()
+        || _changedTiles.size() + _changedTileBlocks.size() >= MaxChangedTiles)
+    {
+        MarkAllTilesChanged();
+        return;
+    }
+
+    // The tile index only knows the first element of each tile, the element before it always ends another tile
+    while (tileElement > firstElement && !(tileElement - 1)->IsLastForTile())
+    {
+        tileElement--;
+    }
+    _changedTileBlocks.push_back(static_cast<size_t>(tileElement - firstElement));
+}
+
+bool TakeChangedTiles(std::vector<TileCoordsXY>& tiles)
+{
+    tiles.clear();
+    if (_allTilesChanged)
+    {
+        _allTilesChanged = false;
+        _changedTiles.clear();
+        _changedTileBlocks.clear();
+        return false;
+    }
+
+    tiles.swap(_changedTiles);
+    if (!_changedTileBlocks.empty())
+    {
+        if (!_tileBlockOwnersValid)
+        {
+            BuildTileBlockOwners();
+        }
+        for (auto block : _changedTileBlocks)
+        {
+            auto owner = _tileBlockOwners.find(block);
+            if (owner != _tileBlockOwners.end())
+            {
+                tiles.push_back(owner->second);
+            }
+        }
+        _changedTileBlocks.clear();
+    }
+    return true;
+}
+
 void SetTileElements(std::vector<TileElement>&& tileElements)
 {
+    MarkAllTilesChanged();
     _tileElements = std::move(tileElements);
     _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data());
     _tileElementsInUse = _tileElements.size();
@@ -338,7 +475,8 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         log_error("Trying to access element outside of range");
         return;
     }
-    _tileIndex.SetTile(tilePos, elements);
+    SetTileBlock(tilePos, elements);
+    MarkTileElementsChanged(tilePos);
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -472,6 +610,7 @@ void map_strip_ghost_flag_from_elements()
     {
         element.SetGhost(false);
     }
+    MarkAllTilesChanged();
 }
 
 /**
@@ -1012,6 +1151,8 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    MarkTileElementChanged(tileElement);
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1173,7 +1314,8 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     }
 
     // Set tile index pointer to point to new element block
-    _tileIndex.SetTile(tileLoc, newTileElement);
+    SetTileBlock(tileLoc, newTileElement);
+    MarkTileElementsChanged(tileLoc);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1231,6 +1373,54 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     return insertedElement;
 }
 
+/**
+ * Replaces all the elements on a tile with the given elements. Unlike tile_element_insert, a tile that grows is
+ * allocated once for its new size rather than once per extra element.
+ */
+bool map_replace_tile_elements(const TileCoordsXY& tilePos, const TileElement* elements, size_t numElements)
+{
+    if (numElements == 0 || !map_is_location_valid(tilePos.ToCoordsXY()))
+    {
+        return false;
+    }
+
+    auto* tileElement = _tileIndex.GetFirstElementAt(tilePos);
+    auto numElementsOnTile = tileElement == nullptr ? 0 : CountElementsOnTile(tilePos.ToCoordsXY());
+    if (numElements > numElementsOnTile)
+    {
+        auto* newTileElement = AllocateTileElements(numElementsOnTile, numElements - numElementsOnTile);
+        if (newTileElement == nullptr)
+        {
+            return false;
+        }
+
+        // The allocation may have reorganised the tile elements, so look the old block up again before freeing it
+        tileElement = _tileIndex.GetFirstElementAt(tilePos);
+        for (size_t i = 0; i < numElementsOnTile; i++)
+        {
+            tileElement[i].base_height = MAX_ELEMENT_HEIGHT;
+        }
+        SetTileBlock(tilePos, newTileElement);
+        tileElement = newTileElement;
+    }
+    else
+    {
+        for (size_t i = numElements; i < numElementsOnTile; i++)
+        {
+            tileElement[i].base_height = MAX_ELEMENT_HEIGHT;
+        }
+        _tileElementsInUse -= numElementsOnTile - numElements;
+    }
+    MarkTileElementsChanged(tilePos);
+
+    std::copy_n(elements, numElements, tileElement);
+    for (size_t i = 0; i < numElements; i++)
+    {
+        tileElement[i].SetLastForTile(i == numElements - 1);
+    }
+    return true;
+}
+
 /**
  *
  *  rct2: 0x0068BB18
@@ -2025,11 +2215,12 @@ ScreenCoordsXY translate_3d_to_2d_with_z(int32_t rotation, const CoordsXYZ& pos)
     return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
 }
 
-static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
-{
-    if (gOpenRCT2Headless)
-        return;
+static int32_t _invalidateBatchDepth;
+// Pending tile invalidations keyed by position and zoom level, holding the merged z range
+static std::unordered_map<uint64_t, std::pair<int32_t, int32_t>> _pendingTileInvalidations;
 
+static void map_invalidate_tile_screen(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
+{
     int32_t x1, y1, x2, y2;
 
     x += 16;
@@ -2044,6 +2235,47 @@ static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int
     viewports_invalidate(x1, y1, x2, y2, maxZoom);
 }
 
+static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
+{
+    if (gOpenRCT2Headless)
+        return;
+
+    if (_invalidateBatchDepth > 0)
+    {
+        auto key = (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | (static_cast<uint64_t>(y & 0xFFFF) << 16)
+            | static_cast<uint16_t>(maxZoom);
+        auto [it, inserted] = _pendingTileInvalidations.try_emplace(key, z0, z1);
+        if (!inserted)
+        {
+            it->second.first = std::min(it->second.first, z0);
+            it->second.second = std::max(it->second.second, z1);
+        }
+        return;
+    }
+
+    map_invalidate_tile_screen(x, y, z0, z1, maxZoom);
+}
+
+void map_invalidate_begin_batch()
+{
+    _invalidateBatchDepth++;
+}
+
+void map_invalidate_end_batch()
+{
+    if (_invalidateBatchDepth == 0 || --_invalidateBatchDepth > 0)
+        return;
+
+    for (const auto& [key, zRange] : _pendingTileInvalidations)
+    {
+        auto x = static_cast<int32_t>(key >> 32);
+        auto y = static_cast<int32_t>((key >> 16) & 0xFFFF);
+        auto maxZoom = static_cast<int32_t>(static_cast<int16_t>(key & 0xFFFF));
+        map_invalidate_tile_screen(x, y, zRange.first, zRange.second, maxZoom);
+    }
+    _pendingTileInvalidations.clear();
+}
+
 /**
  *
  *  rct2: 0x006EC847
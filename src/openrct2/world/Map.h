@@ -174,6 +174,25 @@ public:
 
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
+
+/**
+ * Changes whenever tile elements are inserted, removed or moved, so caches holding tile element pointers can tell when
+ * they have gone stale.
+ */
+uint32_t GetTileElementsGeneration();
+
+/**
+ * Records that the elements of a tile have changed, for changes made in place that per tile caches depend on (e.g.
+ * path additions) as well as for elements being inserted, removed or moved. Both increment the generation.
+ */
+void MarkTileElementsChanged(const TileCoordsXY& tilePos);
+void MarkTileElementChanged(const TileElement* tileElement);
+
+/**
+ * Fills tiles with the tiles changed since the last call. Returns false if the whole map has changed instead, e.g.
+ * after a park was loaded. There is only one list of changes, so only one per tile cache can rely on it.
+ */
+bool TakeChangedTiles(std::vector<TileCoordsXY>& tiles);
 void SetTileElements(std::vector<TileElement>&& tileElements);
 void StashMap();
 void UnstashMap();
@@ -216,6 +235,7 @@ void map_invalidate_map_selection_tiles();
 void map_invalidate_selection_rect();
 bool MapCheckCapacityAndReorganise(const CoordsXY& loc, size_t numElements = 1);
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type);
+bool map_replace_tile_elements(const TileCoordsXY& tilePos, const TileElement* elements, size_t numElements);
 
 template<typename T> T* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants)
 {
@@ -272,6 +292,10 @@ void map_invalidate_tile_full(const CoordsXY& tilePos);
 void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement);
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs);
 
+// Tile invalidations between these calls are merged per tile and applied by the outermost end call.
+void map_invalidate_begin_batch();
+void map_invalidate_end_batch();
+
 int32_t map_get_tile_side(const CoordsXY& mapPos);
 int32_t map_get_tile_quadrant(const CoordsXY& mapPos);
 int32_t map_get_corner_height(int32_t z, int32_t slope, int32_t direction);
@@ -26,40 +26,28 @@
 #include "Scenery.h"
 #include "SmallScenery.h"
 
+#include <unordered_set>
+
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
 static std::vector<MapAnimation> _mapAnimations;
-
-constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
+// Keys of every animation in _mapAnimations, so creating an animation does not have to search the whole list
+static std::unordered_set<uint64_t> _mapAnimationKeys;
 
 static bool InvalidateMapAnimation(const MapAnimation& obj);
 
-static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
+static uint64_t GetMapAnimationKey(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
-    {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
-            return true;
-        }
-    }
-    return false;
+    return (static_cast<uint64_t>(type & 0xFF) << 48) | (static_cast<uint64_t>(static_cast<uint16_t>(location.x)) << 32)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(location.y)) << 16) | static_cast<uint16_t>(location.z);
 }
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
 {
-    if (!DoesAnimationExist(type, loc))
+    if (_mapAnimationKeys.insert(GetMapAnimationKey(type, loc)).second)
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
-        {
-            // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
-        }
-        else
-        {
-            log_error("Exceeded the maximum number of animations");
-        }
+        // Create new animation
+        _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
     }
 }
 
@@ -69,19 +57,21 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
  */
 void map_animation_invalidate_all()
 {
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    // Compact the list in place rather than erasing each finished animation, keeping the remaining ones in order
+    auto dst = _mapAnimations.begin();
+    for (auto it = _mapAnimations.begin(); it != _mapAnimations.end(); it++)
     {
         if (InvalidateMapAnimation(*it))
         {
             // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
+            _mapAnimationKeys.erase(GetMapAnimationKey(it->type, it->location));
         }
         else
         {
-            it++;
+            *dst++ = *it;
         }
     }
+    _mapAnimations.erase(dst, _mapAnimations.end());
 }
 
 /**
@@ -608,6 +598,7 @@ const std::vector<MapAnimation>& GetMapAnimations()
 static void ClearMapAnimations()
 {
     _mapAnimations.clear();
+    _mapAnimationKeys.clear();
 }
 
 void AutoCreateMapAnimations()
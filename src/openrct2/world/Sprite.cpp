@@ -34,6 +34,7 @@
 
 static rct_sprite _spriteList[MAX_ENTITIES];
 static std::array<std::list<uint16_t>, EnumValue(EntityType::Count)> gEntityLists;
+static std::array<uint32_t, EnumValue(EntityType::Count)> _entityListGenerations;
 static std::vector<uint16_t> _freeIdList;
 
 static bool _spriteFlashingList[MAX_ENTITIES];
@@ -42,6 +43,8 @@ constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXI
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
 static std::array<std::vector<uint16_t>, SPATIAL_INDEX_SIZE> gSpriteSpatialIndex;
+// Subset of gSpriteSpatialIndex containing only vehicles, see GetVehicleTileList
+static std::array<std::vector<uint16_t>, SPATIAL_INDEX_SIZE> gVehicleSpatialIndex;
 
 constexpr size_t GetSpatialIndexOffset(int32_t x, int32_t y)
 {
@@ -118,6 +121,11 @@ uint16_t GetEntityListCount(EntityType type)
     return static_cast<uint16_t>(gEntityLists[EnumValue(type)].size());
 }
 
+uint32_t GetEntityListGeneration(EntityType type)
+{
+    return _entityListGenerations[EnumValue(type)];
+}
+
 uint16_t GetNumFreeEntities()
 {
     return static_cast<uint16_t>(_freeIdList.size());
@@ -158,6 +166,11 @@ const std::vector<uint16_t>& GetEntityTileList(const CoordsXY& spritePos)
     return gSpriteSpatialIndex[GetSpatialIndexOffset(spritePos.x, spritePos.y)];
 }
 
+const std::vector<uint16_t>& GetVehicleTileList(const CoordsXY& spritePos)
+{
+    return gVehicleSpatialIndex[GetSpatialIndexOffset(spritePos.x, spritePos.y)];
+}
+
 void SpriteBase::Invalidate()
 {
     if (sprite_left == LOCATION_NULL)
@@ -202,6 +215,10 @@ static void ResetEntityLists()
     {
         list.clear();
     }
+    for (auto& generation : _entityListGenerations)
+    {
+        generation++;
+    }
 }
 
 static void ResetFreeIds()
@@ -258,6 +275,10 @@ void reset_sprite_spatial_index()
     {
         vec.clear();
     }
+    for (auto& vec : gVehicleSpatialIndex)
+    {
+        vec.clear();
+    }
     for (size_t i = 0; i < MAX_ENTITIES; i++)
     {
         auto* spr = GetEntity(i);
@@ -320,6 +341,7 @@ static void AddToEntityList(SpriteBase* entity)
     auto& list = gEntityLists[EnumValue(entity->Type)];
     // Entity list must be in sprite_index order to prevent desync issues
     list.insert(std::lower_bound(std::begin(list), std::end(list), entity->sprite_index), entity->sprite_index);
+    _entityListGenerations[EnumValue(entity->Type)]++;
 }
 
 static void AddToFreeList(uint16_t index)
@@ -335,6 +357,7 @@ static void RemoveFromEntityList(SpriteBase* entity)
     if (ptr != std::end(list) && *ptr == entity->sprite_index)
     {
         list.erase(ptr);
+        _entityListGenerations[EnumValue(entity->Type)]++;
     }
 }
 
@@ -453,6 +476,13 @@ static void SpriteSpatialInsert(SpriteBase* sprite, const CoordsXY& newLoc)
     auto& spatialVector = gSpriteSpatialIndex[newIndex];
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), sprite->sprite_index);
     spatialVector.insert(index, sprite->sprite_index);
+
+    if (sprite->Type == EntityType::Vehicle)
+    {
+        auto& vehicleVector = gVehicleSpatialIndex[newIndex];
+        auto vehicleIndex = std::lower_bound(std::begin(vehicleVector), std::end(vehicleVector), sprite->sprite_index);
+        vehicleVector.insert(vehicleIndex, sprite->sprite_index);
+    }
 }
 
 static void SpriteSpatialRemove(SpriteBase* sprite)
@@ -468,6 +498,22 @@ static void SpriteSpatialRemove(SpriteBase* sprite)
     {
         log_warning("Bad sprite spatial index. Rebuilding the spatial index...");
         reset_sprite_spatial_index();
+        return;
+    }
+
+    if (sprite->Type == EntityType::Vehicle)
+    {
+        auto& vehicleVector = gVehicleSpatialIndex[currentIndex];
+        auto vehicleIndex = std::lower_bound(std::begin(vehicleVector), std::end(vehicleVector), sprite->sprite_index);
+        if (vehicleIndex != std::end(vehicleVector) && *vehicleIndex == sprite->sprite_index)
+        {
+            vehicleVector.erase(vehicleIndex, vehicleIndex + 1);
+        }
+        else
+        {
+            log_warning("Bad vehicle spatial index. Rebuilding the spatial index...");
+            reset_sprite_spatial_index();
+        }
     }
 }
 
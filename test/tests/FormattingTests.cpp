@@ -63,6 +63,27 @@ TEST_F(FmtStringTests, without_format_tokens)
     ASSERT_EQ("Guests: ", fmt.WithoutFormatTokens());
 }
 
+TEST_F(FmtStringTests, iteration_compiled)
+{
+    std::string actual;
+
+    auto compiled = CompiledFmtString("{BLACK}Guests: {INT32}");
+    for (const auto& t : FmtString(compiled))
+    {
+        actual += String::StdFormat("[%d:%s]", t.kind, std::string(t.text).c_str());
+    }
+
+    ASSERT_EQ("[29:{BLACK}][1:Guests: ][8:{INT32}]", actual);
+    ASSERT_FALSE(compiled.IsVerbatim);
+}
+
+TEST_F(FmtStringTests, compiled_verbatim)
+{
+    ASSERT_TRUE(CompiledFmtString("{BLACK}This is an {{ESCAPED}} string.").IsVerbatim);
+    ASSERT_FALSE(CompiledFmtString("{STRINGID}").IsVerbatim);
+    ASSERT_FALSE(CompiledFmtString("{POP16}text").IsVerbatim);
+}
+
 class FormattingTests : public testing::Test
 {
 private: